@@ -0,0 +1,48 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#include <iostream>
+#include <string>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+
+#include <nil/crypto3/algebra/algorithms/hash_to_curve.hpp>
+
+using namespace nil::crypto3::algebra;
+
+template<typename GroupType>
+void hash_to_curve_example(const std::string &msg, const std::string &dst) {
+    typename GroupType::value_type point = hash_to_curve<GroupType>(msg, dst);
+    std::cout << "hash_to_curve(\"" << msg << "\"): " << point.to_affine() << std::endl;
+
+    typename GroupType::value_type encoded = encode_to_curve<GroupType>(msg, dst);
+    std::cout << "encode_to_curve(\"" << msg << "\"): " << encoded.to_affine() << std::endl;
+}
+
+int main() {
+    // Suites of the BLS signatures with public keys in G2 and signatures in G1, and the other way around
+    hash_to_curve_example<curves::bls12<381>::g1_type<>>("abc", "BLS_SIG_BLS12381G1_XMD:SHA-256_SSWU_RO_NUL_");
+    hash_to_curve_example<curves::bls12<381>::g2_type<>>("abc", "BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_NUL_");
+}
@@ -0,0 +1,187 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_BATCH_PAIRING_ALGORITHM_HPP
+#define CRYPTO3_ALGEBRA_BATCH_PAIRING_ALGORITHM_HPP
+
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/random/random_device.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+
+#include <nil/crypto3/algebra/multiexp/multiexp.hpp>
+#include <nil/crypto3/algebra/multiexp/policies.hpp>
+#include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /** @brief Randomized batch verification of pairing-product equations prod_i e(P_i, Q_i) = 1.
+             *
+             *  Equation j is raised to a random 128-bit scalar r_j (r_0 = 1), and all equations are
+             *  multiplied together. Terms sharing a G2 argument are merged through
+             *  e(P, Q)^a * e(P', Q)^b = e(a*P + b*P', Q), with the G1 side computed by a multi-scalar
+             *  multiplication. verify() then runs one multi Miller loop over the distinct G2 arguments
+             *  and one final exponentiation. A batch holding a false equation passes with
+             *  probability about 2^-128, provided the r_j cannot be predicted: they are drawn from the
+             *  operating system entropy source, as random_element does.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            class batch_pairing_verifier {
+                using scalar_value_type = typename PairingCurveType::scalar_field_type::value_type;
+                using gt_value_type = typename PairingCurveType::gt_type::value_type;
+
+            public:
+                using g1_value_type = typename PairingCurveType::template g1_type<>::value_type;
+                using g2_value_type = typename PairingCurveType::template g2_type<>::value_type;
+
+                /// Adds prod e(P_i, Q_i) = 1 for P_i in [g1_first, g1_last) and Q_i starting at g2_first.
+                template<typename InputG1Iterator, typename InputG2Iterator>
+                void add_equation(InputG1Iterator g1_first, InputG1Iterator g1_last, InputG2Iterator g2_first) {
+                    add_equation(g1_first, g1_last, g2_first, rng);
+                }
+
+                /// Same, with the random scalar of the equation drawn from the caller's rng, which must be a
+                /// cryptographically secure generator for the check to be sound.
+                template<typename InputG1Iterator, typename InputG2Iterator, typename RNG>
+                void add_equation(InputG1Iterator g1_first, InputG1Iterator g1_last, InputG2Iterator g2_first,
+                                  RNG &rng) {
+                    const scalar_value_type r = equations_count++ == 0 ? scalar_value_type::one() : random_scalar(rng);
+
+                    for (; g1_first != g1_last; ++g1_first, ++g2_first) {
+                        // e(O, Q) = e(P, O) = 1, such terms are dropped
+                        if (g1_first->is_zero() || g2_first->is_zero()) {
+                            continue;
+                        }
+                        bucket_type &bucket = find_bucket(*g2_first);
+                        bucket.g1_elements.emplace_back(*g1_first);
+                        bucket.scalars.emplace_back(r);
+                    }
+                }
+
+                /// Adds prod e(P_i, Q_i) = 1 over a range of (P_i, Q_i) pairs.
+                template<typename InputRange>
+                void add_equation(const InputRange &pairs) {
+                    add_equation(pairs, rng);
+                }
+
+                template<typename InputRange, typename RNG>
+                void add_equation(const InputRange &pairs, RNG &rng) {
+                    std::vector<g1_value_type> g1_elements;
+                    std::vector<g2_value_type> g2_elements;
+                    for (const auto &pair : pairs) {
+                        g1_elements.emplace_back(pair.first);
+                        g2_elements.emplace_back(pair.second);
+                    }
+                    add_equation(g1_elements.cbegin(), g1_elements.cend(), g2_elements.cbegin(), rng);
+                }
+
+                std::size_t equations_size() const {
+                    return equations_count;
+                }
+
+                /// Number of Miller loops verify() runs at most.
+                std::size_t distinct_g2_size() const {
+                    return buckets.size();
+                }
+
+                /// True if all added equations hold, except with negligible probability.
+                bool verify() const {
+                    std::vector<std::pair<typename PairingPolicy::g1_precomputed_type,
+                                          typename PairingPolicy::g2_precomputed_type>>
+                        precomputed_pairs;
+                    precomputed_pairs.reserve(buckets.size());
+
+                    for (const bucket_type &bucket : buckets) {
+                        const g1_value_type P = multiexp<policies::multiexp_method_BDLO12>(
+                            bucket.g1_elements.cbegin(), bucket.g1_elements.cend(), bucket.scalars.cbegin(),
+                            bucket.scalars.cend(), 1);
+                        if (P.is_zero()) {
+                            continue;
+                        }
+                        precomputed_pairs.emplace_back(PairingPolicy::precompute_g1::process(P),
+                                                       PairingPolicy::precompute_g2::process(bucket.g2_element));
+                    }
+
+                    const gt_value_type f =
+                        PairingPolicy::multi_miller_loop::process(precomputed_pairs.cbegin(), precomputed_pairs.cend());
+                    return PairingPolicy::final_exponentiation::process(f) == gt_value_type::one();
+                }
+
+            private:
+                struct bucket_type {
+                    g2_value_type g2_element;
+                    std::vector<g1_value_type> g1_elements;
+                    std::vector<scalar_value_type> scalars;
+                };
+
+                /* G2 arguments are few (verification key elements and one or two per proof),
+                   a linear scan is cheaper than keeping them ordered */
+                bucket_type &find_bucket(const g2_value_type &Q) {
+                    for (bucket_type &bucket : buckets) {
+                        if (bucket.g2_element == Q) {
+                            return bucket;
+                        }
+                    }
+                    buckets.emplace_back(bucket_type {Q, {}, {}});
+                    return buckets.back();
+                }
+
+                /// Uniform in [1, 2^128 - 1], built from whole outputs of rng whatever their width.
+                template<typename RNG>
+                static scalar_value_type random_scalar(RNG &rng) {
+                    using integral_type = typename PairingCurveType::scalar_field_type::integral_type;
+
+                    boost::random::uniform_int_distribution<integral_type> distribution(
+                        integral_type(1), integral_type((integral_type(1) << 128) - integral_type(1)));
+                    return scalar_value_type(distribution(rng));
+                }
+
+                boost::random_device rng;
+                std::vector<bucket_type> buckets;
+                std::size_t equations_count = 0;
+            };
+
+            /** @brief Checks every equation in [first, last) with one batch_pairing_verifier. Each equation is
+             *  a range of (g1 value, g2 value) pairs whose pairing product must be one.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename InputIterator>
+            bool batch_pairing_product_check(InputIterator first, InputIterator last) {
+                batch_pairing_verifier<PairingCurveType, PairingPolicy> verifier;
+                for (; first != last; ++first) {
+                    verifier.add_equation(*first);
+                }
+                return verifier.verify();
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_BATCH_PAIRING_ALGORITHM_HPP
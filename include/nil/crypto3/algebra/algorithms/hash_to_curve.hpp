@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_HASH_TO_CURVE_ALGORITHM_HPP
+#define CRYPTO3_ALGEBRA_HASH_TO_CURVE_ALGORITHM_HPP
+
+#include <algorithm>
+#include <thread>
+
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_functions.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+
+            /** @brief hash_to_curve of RFC 9380, msg to a point of GroupType indistinguishable from a random
+             *  oracle, under the domain separation tag dst. This is the hash of BLS signatures, e.g. with
+             *  dst = "BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_NUL_" for signatures in G2.
+             *  Supported for the groups with a curves::detail::h2c_suite.
+             */
+            template<typename GroupType, typename MsgRange, typename DstRange>
+            typename GroupType::value_type hash_to_curve(const MsgRange &msg, const DstRange &dst) {
+
+                return curves::detail::h2c<GroupType>::hash_to_curve(msg, dst);
+            }
+
+            /** @brief encode_to_curve of RFC 9380, a cheaper encoding of msg to GroupType whose output is
+             *  not uniformly distributed.
+             */
+            template<typename GroupType, typename MsgRange, typename DstRange>
+            typename GroupType::value_type encode_to_curve(const MsgRange &msg, const DstRange &dst) {
+
+                return curves::detail::h2c<GroupType>::encode_to_curve(msg, dst);
+            }
+
+            /** @brief hash_to_curve of each message in [first, last) under the same dst, written to out as
+             *  affine points, e.g. the G2 hashes of the distinct messages of an aggregate BLS signature.
+             *  Hashing, mapping and cofactor clearing are split across threads_count threads, the affine
+             *  normalization of all the results takes a single field inversion.
+             */
+            template<typename GroupType, typename MsgRandomAccessIterator, typename DstRange,
+                     typename AffineRandomAccessIterator>
+            void batch_hash_to_curve(MsgRandomAccessIterator first, MsgRandomAccessIterator last, const DstRange &dst,
+                                     AffineRandomAccessIterator out,
+                                     std::size_t threads_count =
+                                         std::max<std::size_t>(1, std::thread::hardware_concurrency())) {
+
+                curves::detail::h2c<GroupType>::batch_hash_to_curve(first, last, dst, out, threads_count);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_HASH_TO_CURVE_ALGORITHM_HPP
@@ -26,6 +26,10 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_ALGORITHM_HPP
 
+#include <iterator>
+#include <utility>
+#include <vector>
+
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 namespace nil {
@@ -39,20 +43,26 @@ namespace nil {
             //     return PairingCurveType::pairing::affine_ate_precompute_g1(P);
             // }
 
-            // template<typename PairingCurveType>
-            // typename PairingCurveType::pairing::affine_ate_g2_precomp
-            //     affine_ate_precompute_g2(const typename PairingCurveType::pairing::g2_type::value_type &P) {
+            /** @brief Precomputes the lines of a fixed G2 argument in affine form, for policies that provide
+             *  affine_precompute_g2. G1 arguments use the regular precompute_g1.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingPolicy::affine_g2_precomputed_type
+                affine_precompute_g2(const typename PairingCurveType::template g2_type<>::value_type &P) {
 
-            //     return PairingCurveType::pairing::affine_ate_precompute_g2(P);
-            // }
+                return PairingPolicy::affine_precompute_g2::process(P);
+            }
 
-            // template<typename PairingCurveType>
-            // typename PairingCurveType::pairing::gt_type::value_type
-            //     affine_ate_miller_loop(const typename PairingCurveType::pairing::affine_ate_g1_precomp &prec_P,
-            //                            const typename PairingCurveType::pairing::affine_ate_g2_precomp &prec_Q) {
+            /** @brief Miller loop over affine G2 lines. Equal to miller_loop up to a factor killed by
+             *  final_exponentiation.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingCurveType::gt_type::value_type
+                affine_miller_loop(const typename PairingPolicy::g1_precomputed_type &prec_P,
+                                   const typename PairingPolicy::affine_g2_precomputed_type &prec_Q) {
 
-            //     return PairingCurveType::pairing::affine_ate_miller_loop(prec_P, prec_Q);
-            // }
+                return PairingPolicy::affine_miller_loop::process(prec_P, prec_Q);
+            }
 
             template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
             typename PairingPolicy::g1_precomputed_type
@@ -117,6 +127,63 @@ namespace nil {
                 return PairingPolicy::final_exponentiation::process(elt);
             }
 
+            /** @brief elt^exponent for elt in GT, e.g. a reduced pairing value, for policies that provide
+             *  gt_exponentiation. Faster than elt.pow(exponent), which knows nothing of the order of elt.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
+            typename PairingCurveType::gt_type::value_type
+                gt_exponentiation(const typename PairingCurveType::gt_type::value_type &elt,
+                                  const typename PairingCurveType::scalar_field_type::value_type &exponent) {
+
+                return PairingPolicy::gt_exponentiation::process(elt, exponent);
+            }
+
+            /** @brief Product of the Miller loops of all pairs in [first, last), each element holding a
+             *  g1 precomputed value in .first and a g2 precomputed value in .second.
+             *  f is squared once per loop bit whatever the number of pairs.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename InputIterator>
+            typename PairingCurveType::gt_type::value_type multi_miller_loop(InputIterator first, InputIterator last) {
+
+                return PairingPolicy::multi_miller_loop::process(first, last);
+            }
+
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename InputRange>
+            typename PairingCurveType::gt_type::value_type multi_miller_loop(const InputRange &precomputed_pairs) {
+
+                return PairingPolicy::multi_miller_loop::process(std::cbegin(precomputed_pairs),
+                                                                 std::cend(precomputed_pairs));
+            }
+
+            /** @brief Checks that prod e(P_i, Q_i) = 1 for P_i in [g1_first, g1_last) and Q_i starting at g2_first,
+             *  with a single multi Miller loop and a single final exponentiation.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename InputG1Iterator, typename InputG2Iterator>
+            bool pairing_product_check(InputG1Iterator g1_first, InputG1Iterator g1_last, InputG2Iterator g2_first) {
+                using gt_value_type = typename PairingCurveType::gt_type::value_type;
+
+                std::vector<std::pair<typename PairingPolicy::g1_precomputed_type,
+                                      typename PairingPolicy::g2_precomputed_type>>
+                    precomputed_pairs;
+                precomputed_pairs.reserve(std::distance(g1_first, g1_last));
+
+                for (; g1_first != g1_last; ++g1_first, ++g2_first) {
+                    // e(O, Q) = e(P, O) = 1, such pairs are dropped
+                    if (g1_first->is_zero() || g2_first->is_zero()) {
+                        continue;
+                    }
+                    precomputed_pairs.emplace_back(PairingPolicy::precompute_g1::process(*g1_first),
+                                                   PairingPolicy::precompute_g2::process(*g2_first));
+                }
+
+                const gt_value_type f =
+                    PairingPolicy::multi_miller_loop::process(precomputed_pairs.cbegin(), precomputed_pairs.cend());
+                return PairingPolicy::final_exponentiation::process(f) == gt_value_type::one();
+            }
+
             template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>>
             typename PairingCurveType::gt_type::value_type
                 miller_loop(const typename PairingPolicy::g1_precomputed_type &prec_P,
@@ -0,0 +1,133 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_PARALLEL_PAIRING_ALGORITHM_HPP
+#define CRYPTO3_ALGEBRA_PARALLEL_PAIRING_ALGORITHM_HPP
+
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                inline std::size_t default_pairing_threads_count() {
+                    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+                }
+
+                /** @brief Splits [0, total_size) into at most chunks_count contiguous chunks, runs
+                 *  process(chunk_begin, chunk_end) for each chunk on its own thread and returns the product of
+                 *  the partial results, multiplied in chunk order.
+                 */
+                template<typename GTValueType, typename ChunkProcessor>
+                GTValueType parallel_chunked_product(const std::size_t total_size, std::size_t chunks_count,
+                                                     const ChunkProcessor &process) {
+                    chunks_count = std::max<std::size_t>(1, std::min(chunks_count, total_size));
+
+                    if (chunks_count == 1) {
+                        return process(0, total_size);
+                    }
+
+                    const std::size_t one_chunk_size = total_size / chunks_count;
+
+                    std::vector<std::future<GTValueType>> partial_results;
+                    partial_results.reserve(chunks_count - 1);
+                    for (std::size_t i = 1; i < chunks_count; ++i) {
+                        const std::size_t begin = i * one_chunk_size;
+                        const std::size_t end = (i == chunks_count - 1) ? total_size : begin + one_chunk_size;
+                        partial_results.emplace_back(std::async(std::launch::async, process, begin, end));
+                    }
+
+                    // the calling thread takes the first chunk
+                    GTValueType result = process(0, one_chunk_size);
+                    for (auto &partial_result : partial_results) {
+                        result = result * partial_result.get();
+                    }
+
+                    return result;
+                }
+            }    // namespace detail
+
+            /** @brief Multi Miller loop over the (g1 precomputed, g2 precomputed) pairs in [first, last),
+             *  partitioned across threads_count threads. Each thread runs the policy multi_miller_loop
+             *  over a contiguous subset of the pairs and the GT partial results are multiplied together.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename RandomAccessIterator>
+            typename PairingCurveType::gt_type::value_type
+                parallel_multi_miller_loop(RandomAccessIterator first, RandomAccessIterator last,
+                                           const std::size_t threads_count = detail::default_pairing_threads_count()) {
+                using gt_value_type = typename PairingCurveType::gt_type::value_type;
+
+                return detail::parallel_chunked_product<gt_value_type>(
+                    std::distance(first, last), threads_count, [first](std::size_t begin, std::size_t end) {
+                        return PairingPolicy::multi_miller_loop::process(first + begin, first + end);
+                    });
+            }
+
+            /** @brief Checks that prod e(P_i, Q_i) = 1 for P_i in [g1_first, g1_last) and Q_i starting at
+             *  g2_first. Precomputations and Miller loops are partitioned across threads_count threads,
+             *  the final exponentiation is done once on the product of the partial results.
+             */
+            template<typename PairingCurveType, typename PairingPolicy = pairing::pairing_policy<PairingCurveType>,
+                     typename G1RandomAccessIterator, typename G2RandomAccessIterator>
+            bool parallel_pairing_product_check(G1RandomAccessIterator g1_first, G1RandomAccessIterator g1_last,
+                                                G2RandomAccessIterator g2_first,
+                                                const std::size_t threads_count =
+                                                    detail::default_pairing_threads_count()) {
+                using gt_value_type = typename PairingCurveType::gt_type::value_type;
+                using precomputed_pair_type =
+                    std::pair<typename PairingPolicy::g1_precomputed_type, typename PairingPolicy::g2_precomputed_type>;
+
+                const gt_value_type f = detail::parallel_chunked_product<gt_value_type>(
+                    std::distance(g1_first, g1_last), threads_count,
+                    [g1_first, g2_first](std::size_t begin, std::size_t end) {
+                        std::vector<precomputed_pair_type> precomputed_pairs;
+                        precomputed_pairs.reserve(end - begin);
+                        for (std::size_t i = begin; i < end; ++i) {
+                            // e(O, Q) = e(P, O) = 1, such pairs are dropped
+                            if (g1_first[i].is_zero() || g2_first[i].is_zero()) {
+                                continue;
+                            }
+                            precomputed_pairs.emplace_back(PairingPolicy::precompute_g1::process(g1_first[i]),
+                                                           PairingPolicy::precompute_g2::process(g2_first[i]));
+                        }
+                        return PairingPolicy::multi_miller_loop::process(precomputed_pairs.cbegin(),
+                                                                         precomputed_pairs.cend());
+                    });
+
+                return PairingPolicy::final_exponentiation::process(f) == gt_value_type::one();
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_PARALLEL_PAIRING_ALGORITHM_HPP
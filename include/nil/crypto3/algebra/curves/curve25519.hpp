@@ -26,6 +26,7 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_CURVE25519_HPP
 #define CRYPTO3_ALGEBRA_CURVES_CURVE25519_HPP
 
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/coordinates.hpp>
 #include <nil/crypto3/algebra/curves/detail/curve25519/types.hpp>
 #include <nil/crypto3/algebra/curves/detail/curve25519/g1.hpp>
 
@@ -45,7 +46,7 @@ namespace nil {
                     typedef typename policy_type::base_field_type base_field_type;
                     typedef typename policy_type::scalar_field_type scalar_field_type;
 
-                    template<typename Coordinates = coordinates::extended_with_a_minus_1,
+                    template<typename Coordinates = coordinates::xz,
                              typename Form = forms::montgomery>
                     using g1_type = typename detail::curve25519_g1<Form, Coordinates>;
                 };
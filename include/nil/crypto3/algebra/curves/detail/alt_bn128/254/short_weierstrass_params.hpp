@@ -102,6 +102,23 @@ namespace nil {
                             typename field_type::value_type(
                                 0x12C85EA5DB8C6DEB4AAB71808DCB408FE3D1E7690C43D37B4CE6CC0166FA7DAA_cppui_modular254,
                                 0x90689D0585FF075EC9E99AD690C3395BC4B313370B38EF355ACDADCD122975B_cppui_modular254)};
+
+                        /// psi(x, y) = (x^p * psi_coeff_X, y^p * psi_coeff_Y) acts on G2 as the multiplication by
+                        /// 6x^2, Q is in G2 iff psi(Q) = 6x^2 * Q, https://eprint.iacr.org/2022/352
+                        constexpr static const typename field_type::value_type psi_coeff_X = typename field_type::value_type(
+                            0x2FB347984F7911F74C0BEC3CF559B143B78CC310C2C3330C99E39557176F553D_cppui_modular254,
+                            0x16C9E55061EBAE204BA4CC8BD75A079432AE2A1D0B7C9DCE1665D51C640FCBA2_cppui_modular253);
+                        constexpr static const typename field_type::value_type psi_coeff_Y = typename field_type::value_type(
+                            0x63CF305489AF5DCDC5EC698B6E2F9B9DBAAE0EDA9C95998DC54014671A0135A_cppui_modular251,
+                            0x7C03CBCAC41049A0704B5A7EC796F2B21807DC98FA25BD282D37F632623B0E3_cppui_modular251);
+                        constexpr static const typename alt_bn128_types<254>::integral_type endomorphism_eigenvalue =
+                            typename alt_bn128_types<254>::integral_type(0x6F4D8248EEB859FBF83E9682E87CFD46_cppui_modular127);
+                        constexpr static const bool is_endomorphism_eigenvalue_neg = false;
+
+                        /// The BN parameter x, clear_cofactor sends Q to G2 from x * Q and psi
+                        constexpr static const typename alt_bn128_types<254>::integral_type cofactor_clearing_x =
+                            typename alt_bn128_types<254>::integral_type(0x44E992B44A6909F1_cppui_modular63);
+                        constexpr static const bool is_cofactor_clearing_x_neg = false;
                     };
 
                     constexpr typename alt_bn128_types<254>::integral_type const
@@ -122,6 +139,17 @@ namespace nil {
                         typename alt_bn128_g2_params<254, forms::short_weierstrass>::field_type::value_type,
                         2> const alt_bn128_g2_params<254, forms::short_weierstrass>::one_fill;
 
+                    constexpr typename alt_bn128_g2_params<254, forms::short_weierstrass>::field_type::value_type const
+                        alt_bn128_g2_params<254, forms::short_weierstrass>::psi_coeff_X;
+                    constexpr typename alt_bn128_g2_params<254, forms::short_weierstrass>::field_type::value_type const
+                        alt_bn128_g2_params<254, forms::short_weierstrass>::psi_coeff_Y;
+                    constexpr typename alt_bn128_types<254>::integral_type const
+                        alt_bn128_g2_params<254, forms::short_weierstrass>::endomorphism_eigenvalue;
+                    constexpr bool const alt_bn128_g2_params<254, forms::short_weierstrass>::is_endomorphism_eigenvalue_neg;
+                    constexpr typename alt_bn128_types<254>::integral_type const
+                        alt_bn128_g2_params<254, forms::short_weierstrass>::cofactor_clearing_x;
+                    constexpr bool const alt_bn128_g2_params<254, forms::short_weierstrass>::is_cofactor_clearing_x_neg;
+
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
@@ -32,6 +32,7 @@
 #include <nil/crypto3/algebra/curves/forms.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/element_g1_affine.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/montgomery/element_g1_affine.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/element_g1.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -109,10 +109,15 @@ namespace nil {
                                 0xfbc9ac10c16d45d4eacdd6489fa006480b17a811cdba46922896085f89faaf6_cppui_modular252),
                             typename base_field_type::value_type(
                                 0x203a710160811d5c07ebaeb8fe1d9ce201c66b970d66f18d0d2b264c195309aa_cppui_modular254)};
+
+                        constexpr static const typename field_type::value_type a24 =
+                            typename field_type::value_type(0xa4bfu);    ///< (A + 2) / 4 for the xz ladder
                     };
 
                     constexpr std::array<typename babyjubjub_g1_params<forms::montgomery>::base_field_type::value_type,
                                          2> const babyjubjub_g1_params<forms::montgomery>::one_fill;
+                    constexpr typename babyjubjub_g1_params<forms::montgomery>::field_type::value_type const
+                        babyjubjub_g1_params<forms::montgomery>::a24;
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
@@ -73,6 +73,20 @@ namespace nil {
                                 0x17F1D3A73197D7942695638C4FA9AC0FC3688C4F9774B905A14E3A3F171BAC586C55E83FF97A1AEFFB3AF00ADB22C6BB_cppui_modular381),
                             typename field_type::value_type(
                                 0x8B3F481E3AAA0F1A09E30ED741D8AE4FCF5E095D5D00AF600DB18CB2C04B3EDD03CC744A2888AE40CAA232946C5E7E1_cppui_modular380)};
+
+                        /// sigma(x, y) = (cube_root_of_unity * x, y) acts on G1 as the multiplication by -z^2,
+                        /// P is in G1 iff sigma(P) = -z^2 * P, https://eprint.iacr.org/2021/1130
+                        constexpr static const typename field_type::value_type cube_root_of_unity =
+                            typename field_type::value_type(
+                                0x5F19672FDF76CE51BA69C6076A0F77EADDB3A93BE6F89688DE17D813620A00022E01FFFFFFFEFFFE_cppui_modular319);
+                        constexpr static const typename bls12_types<381>::integral_type endomorphism_eigenvalue =
+                            typename bls12_types<381>::integral_type(0xAC45A4010001A4020000000100000000_cppui_modular128);
+                        constexpr static const bool is_endomorphism_eigenvalue_neg = true;
+
+                        /// The BLS parameter z, clear_cofactor multiplies by 1 - z, the h_eff of RFC 9380 8.8.1
+                        constexpr static const typename bls12_types<381>::integral_type cofactor_clearing_z =
+                            typename bls12_types<381>::integral_type(0xD201000000010000_cppui_modular64);
+                        constexpr static const bool is_cofactor_clearing_z_neg = true;
                     };
 
                     template<>
@@ -106,6 +120,29 @@ namespace nil {
                             typename field_type::value_type(
                                 0xCE5D527727D6E118CC9CDC6DA2E351AADFD9BAA8CBDD3A76D429A695160D12C923AC9CC3BACA289E193548608B82801_cppui_modular380,
                                 0x606C4A02EA734CC32ACD2B02BC28B99CB3E287E85A763AF267492AB572E99AB3F370D275CEC1DA1AAA9075FF05F79BE_cppui_modular379)};
+
+                        /// psi(x, y) = (x^p * psi_coeff_X, y^p * psi_coeff_Y) acts on G2 as the multiplication by z,
+                        /// Q is in G2 iff psi(Q) = z * Q, https://eprint.iacr.org/2021/1130
+                        constexpr static const typename field_type::value_type psi_coeff_X =
+                            typename field_type::value_type(
+                                field_type::value_type::underlying_type::zero(),
+                                typename field_type::value_type::underlying_type(
+                                    0x1A0111EA397FE699EC02408663D4DE85AA0D857D89759AD4897D29650FB85F9B409427EB4F49FFFD8BFD00000000AAAD_cppui_modular381));
+                        constexpr static const typename field_type::value_type psi_coeff_Y =
+                            typename field_type::value_type(
+                                typename field_type::value_type::underlying_type(
+                                    0x135203E60180A68EE2E9C448D77A2CD91C3DEDD930B1CF60EF396489F61EB45E304466CF3E67FA0AF1EE7B04121BDEA2_cppui_modular381),
+                                typename field_type::value_type::underlying_type(
+                                    0x6AF0E0437FF400B6831E36D6BD17FFE48395DABC2D3435E77F76E17009241C5EE67992F72EC05F4C81084FBEDE3CC09_cppui_modular379));
+                        constexpr static const typename bls12_types<381>::integral_type endomorphism_eigenvalue =
+                            typename bls12_types<381>::integral_type(0xD201000000010000_cppui_modular64);
+                        constexpr static const bool is_endomorphism_eigenvalue_neg = true;
+
+                        /// The BLS parameter z, clear_cofactor computes h_eff * Q from z * Q and psi,
+                        /// https://eprint.iacr.org/2017/419
+                        constexpr static const typename bls12_types<381>::integral_type cofactor_clearing_z =
+                            typename bls12_types<381>::integral_type(0xD201000000010000_cppui_modular64);
+                        constexpr static const bool is_cofactor_clearing_z_neg = true;
                     };
 
                     constexpr
@@ -116,6 +153,26 @@ namespace nil {
                     constexpr typename bls12_g2_params<381, forms::short_weierstrass>::field_type::value_type const
                         bls12_g2_params<381, forms::short_weierstrass>::b;
 
+                    constexpr typename bls12_g1_params<381, forms::short_weierstrass>::field_type::value_type const
+                        bls12_g1_params<381, forms::short_weierstrass>::cube_root_of_unity;
+                    constexpr typename bls12_types<381>::integral_type const
+                        bls12_g1_params<381, forms::short_weierstrass>::endomorphism_eigenvalue;
+                    constexpr bool const bls12_g1_params<381, forms::short_weierstrass>::is_endomorphism_eigenvalue_neg;
+                    constexpr typename bls12_types<381>::integral_type const
+                        bls12_g1_params<381, forms::short_weierstrass>::cofactor_clearing_z;
+                    constexpr bool const bls12_g1_params<381, forms::short_weierstrass>::is_cofactor_clearing_z_neg;
+
+                    constexpr typename bls12_g2_params<381, forms::short_weierstrass>::field_type::value_type const
+                        bls12_g2_params<381, forms::short_weierstrass>::psi_coeff_X;
+                    constexpr typename bls12_g2_params<381, forms::short_weierstrass>::field_type::value_type const
+                        bls12_g2_params<381, forms::short_weierstrass>::psi_coeff_Y;
+                    constexpr typename bls12_types<381>::integral_type const
+                        bls12_g2_params<381, forms::short_weierstrass>::endomorphism_eigenvalue;
+                    constexpr bool const bls12_g2_params<381, forms::short_weierstrass>::is_endomorphism_eigenvalue_neg;
+                    constexpr typename bls12_types<381>::integral_type const
+                        bls12_g2_params<381, forms::short_weierstrass>::cofactor_clearing_z;
+                    constexpr bool const bls12_g2_params<381, forms::short_weierstrass>::is_cofactor_clearing_z_neg;
+
                     constexpr std::array<
                         typename bls12_g1_params<381, forms::short_weierstrass>::field_type::value_type,
                         2> const bls12_g1_params<381, forms::short_weierstrass>::zero_fill;
@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_CLEAR_COFACTOR_HPP
+#define CRYPTO3_ALGEBRA_CURVES_CLEAR_COFACTOR_HPP
+
+#include <type_traits>
+
+#include <nil/crypto3/algebra/curves/detail/endomorphisms.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                /// How a point of the curve is sent to the subgroup of order the scalar field modulus
+                namespace clear_cofactor_methods {
+                    /// The point times the effective cofactor h_eff
+                    struct scalar_mul { };
+                    /// P - z * P, the h_eff = 1 - z of BLS12 G1
+                    struct one_minus_z { };
+                    /// h_eff * Q = [z^2 - z - 1] Q + [z - 1] psi(Q) + psi^2(2 Q) on BLS12 G2,
+                    /// https://eprint.iacr.org/2017/419
+                    struct budroni_pintore { };
+                    /// [x] Q + psi([3x] Q) + psi^2([x] Q) + psi^3(Q) on BN G2, a multiple of the cofactor times Q
+                    /// with the multiple prime to the subgroup order, by Fuentes-Castaneda, Knapp and
+                    /// Rodriguez-Henriquez
+                    struct fuentes_castaneda { };
+                }    // namespace clear_cofactor_methods
+
+                namespace detail {
+                    template<typename GroupType, typename = void>
+                    struct clear_cofactor_method {
+                        typedef clear_cofactor_methods::scalar_mul type;
+                    };
+
+                    template<typename GroupType>
+                    struct clear_cofactor_method<GroupType,
+                                                 decltype(void(GroupType::params_type::cofactor_clearing_z))> {
+                        typedef typename std::conditional<has_psi<typename GroupType::params_type>::value,
+                                                          clear_cofactor_methods::budroni_pintore,
+                                                          clear_cofactor_methods::one_minus_z>::type type;
+                    };
+
+                    template<typename GroupType>
+                    struct clear_cofactor_method<GroupType,
+                                                 decltype(void(GroupType::params_type::cofactor_clearing_x))> {
+                        typedef clear_cofactor_methods::fuentes_castaneda type;
+                    };
+
+                    template<typename GroupValueType>
+                    GroupValueType mul_by_cofactor_clearing_z(const GroupValueType &p) {
+                        using params_type = typename GroupValueType::group_type::params_type;
+
+                        const GroupValueType multiple = p * params_type::cofactor_clearing_z;
+                        return params_type::is_cofactor_clearing_z_neg ? -multiple : multiple;
+                    }
+
+                    template<typename GroupValueType>
+                    GroupValueType mul_by_cofactor_clearing_x(const GroupValueType &p) {
+                        using params_type = typename GroupValueType::group_type::params_type;
+
+                        const GroupValueType multiple = p * params_type::cofactor_clearing_x;
+                        return params_type::is_cofactor_clearing_x_neg ? -multiple : multiple;
+                    }
+
+                    template<typename GroupValueType>
+                    GroupValueType clear_cofactor(const GroupValueType &p, clear_cofactor_methods::one_minus_z) {
+                        return p - mul_by_cofactor_clearing_z(p);
+                    }
+
+                    /// clear_cofactor of RFC 9380 G.3: two multiplications by the 64-bit z instead of one
+                    /// by the 636-bit h_eff
+                    template<typename GroupValueType>
+                    GroupValueType clear_cofactor(const GroupValueType &p, clear_cofactor_methods::budroni_pintore) {
+                        const GroupValueType t1 = mul_by_cofactor_clearing_z(p);
+                        GroupValueType t2 = psi(p);
+                        GroupValueType t3 = p;
+                        t3.double_inplace();
+                        t3 = psi(psi(t3)) - t2;
+                        t2 = mul_by_cofactor_clearing_z(t1 + t2);
+                        return t3 + t2 - t1 - p;
+                    }
+
+                    /// One multiplication by the 63-bit x instead of one by the 254-bit cofactor
+                    template<typename GroupValueType>
+                    GroupValueType clear_cofactor(const GroupValueType &p,
+                                                  clear_cofactor_methods::fuentes_castaneda) {
+                        const GroupValueType t0 = mul_by_cofactor_clearing_x(p);
+                        GroupValueType t1 = t0;
+                        t1.double_inplace();
+                        t1 = psi(t1 + t0);
+                        return t0 + t1 + psi(psi(t0)) + psi(psi(psi(p)));
+                    }
+
+                    /// Sends p to the subgroup of order the scalar field modulus with the method of
+                    /// clear_cofactor_method, for the groups whose params provide its parameters
+                    template<typename GroupValueType>
+                    GroupValueType clear_cofactor(const GroupValueType &p) {
+                        return clear_cofactor(
+                            p, typename clear_cofactor_method<typename GroupValueType::group_type>::type());
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_CLEAR_COFACTOR_HPP
@@ -0,0 +1,498 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_MARSHALLING_ALGEBRA_CURVES_COMPRESSED_HPP
+#define CRYPTO3_MARSHALLING_ALGEBRA_CURVES_COMPRESSED_HPP
+
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace nil {
+    namespace marshalling {
+
+        using namespace nil::crypto3;
+
+        /// Byte layouts of compressed_point_serializer. m is the extension degree of the field of
+        /// the coordinates, one component is stored on sizeof_field_element bytes.
+        namespace compression_formats {
+            /// SEC1 2.3.3: 0x02 | parity of y, then x big-endian, highest extension component first.
+            /// The point at infinity is encoded as all zeros, SEC1 uses a single 0x00 octet.
+            struct sec1 { };
+
+            /// ZCash BLS12-381 format: x big-endian, highest extension component first, with the
+            /// compression, infinity and sort flags in the three top bits of the first octet. The
+            /// sort flag is set if y is the lexicographically largest of y and -y.
+            struct zcash { };
+
+            /// RFC 8032 5.1.2: the affine y of a twisted Edwards point, x for short Weierstrass ones,
+            /// little-endian, lowest extension component first, with the parity of the other coordinate
+            /// in the top bit of the last octet. The short Weierstrass point at infinity is all zeros,
+            /// as in the Pasta curves implementations, so x = 0 must not be on the curve.
+            struct little_endian_sign { };
+        }    // namespace compression_formats
+
+        namespace detail {
+            template<typename Form>
+            struct default_compression_format {
+                typedef compression_formats::sec1 type;
+            };
+
+            template<>
+            struct default_compression_format<algebra::curves::forms::twisted_edwards> {
+                typedef compression_formats::little_endian_sign type;
+            };
+
+            template<typename Format>
+            struct compression_format_traits;
+
+            template<>
+            struct compression_format_traits<compression_formats::sec1> {
+                constexpr static const std::size_t prefix_size = 1;
+                constexpr static const std::size_t flag_bits = 0;
+                constexpr static const bool big_endian = true;
+            };
+
+            template<>
+            struct compression_format_traits<compression_formats::zcash> {
+                constexpr static const std::size_t prefix_size = 0;
+                constexpr static const std::size_t flag_bits = 3;
+                constexpr static const bool big_endian = true;
+            };
+
+            template<>
+            struct compression_format_traits<compression_formats::little_endian_sign> {
+                constexpr static const std::size_t prefix_size = 0;
+                constexpr static const std::size_t flag_bits = 1;
+                constexpr static const bool big_endian = false;
+            };
+
+            /// Access to the prime field components of a coordinate, the coordinate itself for a prime
+            /// field, data[i] for an extension of it.
+            template<typename FieldType, bool IsPrimeField = (FieldType::arity == 1)>
+            struct field_components {
+                typedef FieldType base_field_type;
+                typedef typename FieldType::value_type value_type;
+                typedef typename base_field_type::value_type base_value_type;
+
+                constexpr static const std::size_t arity = 1;
+
+                static inline const base_value_type &get(const value_type &v, std::size_t) {
+                    return v;
+                }
+
+                static inline value_type make(const std::array<base_value_type, arity> &components) {
+                    return components[0];
+                }
+            };
+
+            template<typename FieldType>
+            struct field_components<FieldType, false> {
+                typedef typename FieldType::underlying_field_type base_field_type;
+                typedef typename FieldType::value_type value_type;
+                typedef typename base_field_type::value_type base_value_type;
+
+                static_assert(base_field_type::arity == 1, "only direct extensions of a prime field are supported");
+
+                constexpr static const std::size_t arity = FieldType::arity;
+
+                static inline const base_value_type &get(const value_type &v, std::size_t i) {
+                    return v.data[i];
+                }
+
+                static inline value_type make(const std::array<base_value_type, arity> &components) {
+                    typename value_type::data_type data;
+                    std::copy(components.begin(), components.end(), data.begin());
+                    return value_type(data);
+                }
+            };
+        }    // namespace detail
+
+        /** @brief Compressed encoding of the affine points of AffineGroupType, a short Weierstrass or a
+         *  twisted Edwards group over a prime field or over an Fp2 / Fp3 extension of it.
+         *  A point is stored as one coordinate and the sign of the other one, see compression_formats for
+         *  the byte layouts. zcash needs 3 spare bits in the top octet of a field element, e.g. BLS12-381,
+         *  little_endian_sign needs 1, e.g. ed25519, jubjub, Pallas and Vesta.
+         */
+        template<typename AffineGroupType,
+                 typename Format = typename detail::default_compression_format<
+                     typename AffineGroupType::value_type::form>::type>
+        class compressed_point_serializer {
+        public:
+            typedef AffineGroupType group_type;
+            typedef Format format_type;
+            typedef typename group_type::value_type value_type;
+            typedef typename group_type::params_type params_type;
+            typedef typename value_type::form form_type;
+
+            typedef typename group_type::field_type field_type;
+            typedef typename field_type::value_type field_value_type;
+
+        protected:
+            typedef detail::field_components<field_type> components;
+            typedef detail::compression_format_traits<format_type> format_traits;
+
+            typedef typename components::base_field_type base_field_type;
+            typedef typename components::base_value_type base_value_type;
+            typedef typename base_value_type::integral_type integral_type;
+
+            constexpr static const bool is_twisted_edwards =
+                std::is_same<form_type, algebra::curves::forms::twisted_edwards>::value;
+
+        public:
+            constexpr static const std::size_t sizeof_field_element = (base_field_type::modulus_bits + 7) / 8;
+            constexpr static const std::size_t octets_size =
+                format_traits::prefix_size + components::arity * sizeof_field_element;
+
+            typedef std::array<std::uint8_t, octets_size> octets_type;
+
+            static_assert(is_twisted_edwards ||
+                              std::is_same<form_type, algebra::curves::forms::short_weierstrass>::value,
+                          "only short Weierstrass and twisted Edwards points are supported");
+            static_assert(!is_twisted_edwards ||
+                              std::is_same<format_type, compression_formats::little_endian_sign>::value,
+                          "twisted Edwards points are only encoded in the little_endian_sign format");
+            static_assert(8 * sizeof_field_element - base_field_type::modulus_bits >= format_traits::flag_bits,
+                          "no room for the flags of the format in the top octet of a field element");
+
+            static inline octets_type point_to_octets(const value_type &point) {
+                octets_type result = {0};
+
+                if (point.is_zero() && !is_twisted_edwards) {
+                    if constexpr (std::is_same<format_type, compression_formats::zcash>::value) {
+                        result[0] = C_bit | I_bit;
+                    }
+                    return result;
+                }
+
+                // (0, 1) is the neutral element of twisted Edwards curves, whatever zero_fill says
+                const field_value_type x = point.is_zero() ? field_value_type::zero() : point.X;
+                const field_value_type y = point.is_zero() ? field_value_type::one() : point.Y;
+                const field_value_type &stored = is_twisted_edwards ? y : x;
+                const field_value_type &other = is_twisted_edwards ? x : y;
+
+                for (std::size_t i = 0; i < components::arity; ++i) {
+                    write_component(components::get(stored, i), result.data() + component_offset(i));
+                }
+
+                if constexpr (std::is_same<format_type, compression_formats::sec1>::value) {
+                    result[0] = 0x02 | std::uint8_t(sgn0(other));
+                } else if constexpr (std::is_same<format_type, compression_formats::zcash>::value) {
+                    result[0] |= C_bit | (is_lexicographically_largest(other) ? S_bit : 0);
+                } else {
+                    BOOST_ASSERT_MSG(is_twisted_edwards || sgn0(other) ||
+                                         !std::all_of(result.begin(), result.end(),
+                                                      [](std::uint8_t octet) { return octet == 0; }),
+                                     "the encoding of the point collides with the point at infinity");
+                    result[octets_size - 1] |= sgn0(other) ? 0x80 : 0;
+                }
+                return result;
+            }
+
+            /** @brief Decodes octets into result. Returns false, leaving result unchanged, if the
+             *  flags are malformed, a component is not reduced or no point of the curve has the stored
+             *  coordinate. A decompressed point is always on the curve, validation_levels::subgroup also
+             *  checks the subgroup.
+             */
+            template<typename ValidationLevel = validation_levels::on_curve>
+            static inline bool octets_to_point(const octets_type &octets, value_type &result) {
+                octets_type point_octets = octets;
+                bool sign;
+
+                if constexpr (std::is_same<format_type, compression_formats::sec1>::value) {
+                    if (point_octets[0] == 0) {
+                        return read_zero(point_octets, result);
+                    }
+                    if ((point_octets[0] | 1) != 0x03) {
+                        return false;
+                    }
+                    sign = point_octets[0] & 1;
+                } else if constexpr (std::is_same<format_type, compression_formats::zcash>::value) {
+                    const std::uint8_t m_byte = point_octets[0] & 0xE0;
+                    point_octets[0] &= 0x1F;
+                    if (!(m_byte & C_bit) || m_byte == (C_bit | I_bit | S_bit)) {
+                        return false;
+                    }
+                    if (m_byte & I_bit) {
+                        return read_zero(point_octets, result);
+                    }
+                    sign = m_byte & S_bit;
+                } else {
+                    sign = point_octets[octets_size - 1] & 0x80;
+                    point_octets[octets_size - 1] &= 0x7F;
+                    if (!is_twisted_edwards && !sign &&
+                        std::all_of(point_octets.begin(), point_octets.end(),
+                                    [](std::uint8_t octet) { return octet == 0; })) {
+                        result = value_type::zero();
+                        return true;
+                    }
+                }
+
+                std::array<base_value_type, components::arity> stored_components;
+                for (std::size_t i = 0; i < components::arity; ++i) {
+                    if (!read_component(point_octets.data() + component_offset(i), stored_components[i])) {
+                        return false;
+                    }
+                }
+                const field_value_type stored = components::make(stored_components);
+
+                field_value_type other;
+                if (!recover_other_coordinate(stored, other)) {
+                    return false;
+                }
+                if (other.is_zero()) {
+                    // -0 = 0, the sign can not be set
+                    if (sign) {
+                        return false;
+                    }
+                } else if (sign_of(other) != sign) {
+                    other = -other;
+                }
+
+                const value_type point = is_twisted_edwards ? value_type(other, stored) : value_type(stored, other);
+                if constexpr (std::is_same<ValidationLevel, validation_levels::subgroup>::value) {
+                    if (!is_in_subgroup(point)) {
+                        return false;
+                    }
+                }
+                result = point;
+                return true;
+            }
+
+            /// Encodes the affine points [first, last) to out, split into threads_count chunks.
+            template<typename AffineRandomAccessIterator, typename OctetsRandomAccessIterator>
+            static void batch_points_to_octets(AffineRandomAccessIterator first, AffineRandomAccessIterator last,
+                                               OctetsRandomAccessIterator out, std::size_t threads_count = 1) {
+                detail::parallel_chunks(std::distance(first, last), threads_count,
+                                        [first, out](std::size_t begin, std::size_t end) {
+                                            std::transform(first + begin, first + end, out + begin,
+                                                           [](const value_type &point) {
+                                                               return point_to_octets(point);
+                                                           });
+                                            return true;
+                                        });
+            }
+
+            /** @brief Decodes the encodings [first, last) to out, split into threads_count chunks.
+             *  Returns false if any of them is rejected by octets_to_point, out is then left partially
+             *  written.
+             */
+            template<typename ValidationLevel = validation_levels::on_curve, typename OctetsRandomAccessIterator,
+                     typename AffineRandomAccessIterator>
+            static bool batch_octets_to_points(OctetsRandomAccessIterator first, OctetsRandomAccessIterator last,
+                                               AffineRandomAccessIterator out, std::size_t threads_count = 1) {
+                return detail::parallel_chunks(std::distance(first, last), threads_count,
+                                               [first, out](std::size_t begin, std::size_t end) {
+                                                   for (std::size_t i = begin; i < end; ++i) {
+                                                       if (!octets_to_point<ValidationLevel>(first[i], out[i])) {
+                                                           return false;
+                                                       }
+                                                   }
+                                                   return true;
+                                               });
+            }
+
+        protected:
+            constexpr static const std::uint8_t C_bit = 0x80;
+            constexpr static const std::uint8_t I_bit = 0x40;
+            constexpr static const std::uint8_t S_bit = 0x20;
+
+            static inline std::size_t component_offset(std::size_t i) {
+                return format_traits::prefix_size +
+                       (format_traits::big_endian ? components::arity - 1 - i : i) * sizeof_field_element;
+            }
+
+            static inline void write_component(const base_value_type &v, std::uint8_t *out) {
+                const integral_type value = v.data.template convert_to<integral_type>();
+                if constexpr (format_traits::big_endian) {
+                    boost::multiprecision::export_bits(
+                        value, std::reverse_iterator<std::uint8_t *>(out + sizeof_field_element), 8, false);
+                } else {
+                    boost::multiprecision::export_bits(value, out, 8, false);
+                }
+            }
+
+            static inline bool read_component(const std::uint8_t *in, base_value_type &result) {
+                integral_type value;
+                boost::multiprecision::import_bits(value, in, in + sizeof_field_element, 8,
+                                                   format_traits::big_endian);
+                if (value >= base_value_type::modulus) {
+                    return false;
+                }
+                result = base_value_type(value);
+                return true;
+            }
+
+            /// The point at infinity, all the octets but the cleared flags must be zero.
+            static inline bool read_zero(const octets_type &point_octets, value_type &result) {
+                if (!std::all_of(point_octets.begin(), point_octets.end(),
+                                 [](std::uint8_t octet) { return octet == 0; })) {
+                    return false;
+                }
+                result = value_type::zero();
+                return true;
+            }
+
+            /// Multiplication by the subgroup order, in projective coordinates for short Weierstrass points
+            static inline bool is_in_subgroup(const value_type &point) {
+                if constexpr (is_twisted_edwards) {
+                    return algebra::curves::detail::subgroup_check(point);
+                } else {
+                    return algebra::curves::detail::subgroup_check(point.to_projective());
+                }
+            }
+
+            /// y from x on y^2 = x^3 + a x + b, x from y on a x^2 + y^2 = 1 + d x^2 y^2
+            static inline bool recover_other_coordinate(const field_value_type &stored, field_value_type &other) {
+                field_value_type other_squared;
+                if constexpr (is_twisted_edwards) {
+                    const field_value_type y2 = stored.squared();
+                    const field_value_type v = field_value_type(params_type::d) * y2 - field_value_type(params_type::a);
+                    if (v.is_zero()) {
+                        return false;
+                    }
+                    other_squared = (y2 - field_value_type::one()) * v.inversed();
+                } else {
+                    other_squared = stored.squared() * stored + field_value_type(params_type::a) * stored +
+                                    field_value_type(params_type::b);
+                }
+
+                if (other_squared.is_zero()) {
+                    other = field_value_type::zero();
+                    return true;
+                }
+                return sqrt_candidate(other_squared, other) && other.squared() == other_squared;
+            }
+
+            /// A square root of v if v is a square, to be checked by squaring it, so that one exponentiation
+            /// is enough where the field allows it: v^((p+1)/4) if p = 3 mod 4, v^((p+3)/8), times sqrt(-1)
+            /// if need be, if p = 5 mod 8 (RFC 8032 5.1.3), and for Fp2 = Fp[u]/(u^2 + 1) with p = 3 mod 4
+            /// the roots in Fp of the norm and of (a0 + sqrt(norm)) / 2. Other fields test is_square first.
+            static inline bool sqrt_candidate(const field_value_type &v, field_value_type &root) {
+                static const bool p_3_mod_4 = boost::multiprecision::bit_test(base_value_type::modulus, 1);
+                static const bool p_5_mod_8 =
+                    !p_3_mod_4 && boost::multiprecision::bit_test(base_value_type::modulus, 2);
+
+                if constexpr (components::arity == 1) {
+                    if (p_3_mod_4) {
+                        root = v.pow(base_sqrt_exponent());
+                        return true;
+                    }
+                    if (p_5_mod_8) {
+                        static const integral_type exponent = (base_value_type::modulus >> 3) + integral_type(1);
+                        static const field_value_type sqrt_minus_one =
+                            field_value_type(2u).pow(integral_type(base_value_type::modulus >> 2));
+
+                        root = v.pow(exponent);
+                        if (root.squared() != v) {
+                            root = root * sqrt_minus_one;
+                        }
+                        return true;
+                    }
+                } else if constexpr (components::arity == 2) {
+                    static const bool u_squared_minus_one =
+                        p_3_mod_4 && field_type::extension_policy::non_residue == -base_value_type::one();
+
+                    if (u_squared_minus_one) {
+                        static const base_value_type two_inv = base_value_type(2u).inversed();
+
+                        const base_value_type &a0 = components::get(v, 0), &a1 = components::get(v, 1);
+                        if (a1.is_zero()) {
+                            // -1 is not a square in Fp, so one of a0 and -a0 is
+                            const base_value_type c = a0.pow(base_sqrt_exponent());
+                            root = (c.squared() == a0) ? components::make({c, base_value_type::zero()}) :
+                                                         components::make({base_value_type::zero(), c});
+                            return true;
+                        }
+
+                        // y = c + a1 / (2c) * u if c^2 = t, y = a1 / (2c) + c * u if c^2 = -t, c = t^((p+1)/4)
+                        const base_value_type norm = a0.squared() + a1.squared();
+                        const base_value_type s = norm.pow(base_sqrt_exponent());
+                        if (s.squared() != norm) {
+                            return false;
+                        }
+                        const base_value_type t = (a0 + s) * two_inv;
+                        const base_value_type c = t.pow(base_sqrt_exponent());
+                        const base_value_type d = a1 * c.doubled().inversed();
+                        root = (c.squared() == t) ? components::make({c, d}) : components::make({d, c});
+                        return true;
+                    }
+                }
+
+                if (!v.is_square()) {
+                    return false;
+                }
+                root = v.sqrt();
+                return true;
+            }
+
+            /// (p+1)/4, for p = 3 mod 4
+            static inline const integral_type &base_sqrt_exponent() {
+                static const integral_type exponent = (base_value_type::modulus >> 2) + integral_type(1);
+                return exponent;
+            }
+
+            static inline bool sign_of(const field_value_type &v) {
+                if constexpr (std::is_same<format_type, compression_formats::zcash>::value) {
+                    return is_lexicographically_largest(v);
+                }
+                return sgn0(v);
+            }
+
+            /// sgn0 of RFC 9380 4.1: the parity of the lowest non-zero component
+            static inline bool sgn0(const field_value_type &v) {
+                for (std::size_t i = 0; i < components::arity; ++i) {
+                    const integral_type value = components::get(v, i).data.template convert_to<integral_type>();
+                    if (value != 0) {
+                        return boost::multiprecision::bit_test(value, 0);
+                    }
+                }
+                return false;
+            }
+
+            /// v > -v, comparing the highest non-zero components
+            static inline bool is_lexicographically_largest(const field_value_type &v) {
+                static const integral_type half_p = (base_value_type::modulus - integral_type(1)) / integral_type(2);
+
+                for (std::size_t i = components::arity; i-- > 0;) {
+                    const integral_type value = components::get(v, i).data.template convert_to<integral_type>();
+                    if (value != 0) {
+                        return value > half_p;
+                    }
+                }
+                return false;
+            }
+        };
+    }    // namespace marshalling
+}    // namespace nil
+
+#endif    // CRYPTO3_MARSHALLING_ALGEBRA_CURVES_COMPRESSED_HPP
@@ -45,12 +45,12 @@ namespace nil {
                         using base_field_type = typename curve25519_types::base_field_type;
                         using scalar_field_type = typename curve25519_types::scalar_field_type;
 
-                        constexpr static typename curve25519_types::integral_type a =
+                        constexpr static typename curve25519_types::integral_type A =
                             typename curve25519_types::integral_type(
-                                0x76d06);    ///< coefficient of Montgomery curve $b*y^2=x^3+a*x^2+x$
-                        constexpr static typename curve25519_types::integral_type b =
+                                0x76d06);    ///< coefficient of Montgomery curve $B*y^2=x^3+A*x^2+x$
+                        constexpr static typename curve25519_types::integral_type B =
                             typename curve25519_types::integral_type(
-                                0x01);    ///< coefficient of Montgomery curve $b*y^2=x^3+a*x^2+x$
+                                0x01);    ///< coefficient of Montgomery curve $B*y^2=x^3+A*x^2+x$
                     };
 
                     template<>
@@ -70,6 +70,9 @@ namespace nil {
                             typename field_type::value_type(0x09u),
                             typename field_type::value_type(
                                 0x20ae19a1b8a086b4e01edd2c7748d14c923d4d7e6d7c61b229e9c5a27eced3d9_cppui_modular254)};
+
+                        constexpr static typename field_type::value_type a24 =
+                            typename field_type::value_type(0x1db42u);    ///< (A + 2) / 4 for the xz ladder
 #endif
                     };
 
@@ -128,13 +131,15 @@ namespace nil {
                     };
 #ifdef __ZKLLVM__
 #else
-                    constexpr typename curve25519_types::integral_type curve25519_params<forms::montgomery>::a;
-                    constexpr typename curve25519_types::integral_type curve25519_params<forms::montgomery>::b;
+                    constexpr typename curve25519_types::integral_type curve25519_params<forms::montgomery>::A;
+                    constexpr typename curve25519_types::integral_type curve25519_params<forms::montgomery>::B;
 
                     constexpr std::array<typename curve25519_g1_params<forms::montgomery>::field_type::value_type, 2>
                         curve25519_g1_params<forms::montgomery>::zero_fill;
                     constexpr std::array<typename curve25519_g1_params<forms::montgomery>::field_type::value_type, 2>
                         curve25519_g1_params<forms::montgomery>::one_fill;
+                    constexpr typename curve25519_g1_params<forms::montgomery>::field_type::value_type
+                        curve25519_g1_params<forms::montgomery>::a24;
 
                     constexpr typename curve25519_types::integral_type curve25519_params<forms::twisted_edwards>::a;
                     constexpr typename curve25519_types::integral_type curve25519_params<forms::twisted_edwards>::d;
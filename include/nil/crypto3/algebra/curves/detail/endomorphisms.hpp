@@ -0,0 +1,72 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_ENDOMORPHISMS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_ENDOMORPHISMS_HPP
+
+#include <type_traits>
+
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /// Whether the group params provide the psi_coeff_X and psi_coeff_Y of psi
+                    template<typename ParamsType, typename = void>
+                    struct has_psi : std::false_type { };
+
+                    template<typename ParamsType>
+                    struct has_psi<ParamsType, decltype(void(ParamsType::psi_coeff_X))> : std::true_type { };
+
+                    template<typename GroupValueType>
+                    inline void conjugate_z(GroupValueType &, std::true_type) {
+                    }
+
+                    template<typename GroupValueType>
+                    inline void conjugate_z(GroupValueType &p, std::false_type) {
+                        p.Z = p.Z.Frobenius_map(1);
+                    }
+
+                    /// psi(x, y) = (x^p * psi_coeff_X, y^p * psi_coeff_Y), the untwist-Frobenius-twist endomorphism
+                    /// of the groups over Fp2 whose params provide psi_coeff_X and psi_coeff_Y
+                    template<typename GroupValueType>
+                    GroupValueType psi(const GroupValueType &p) {
+                        using params_type = typename GroupValueType::group_type::params_type;
+
+                        GroupValueType image = p;
+                        image.X = p.X.Frobenius_map(1) * params_type::psi_coeff_X;
+                        image.Y = p.Y.Frobenius_map(1) * params_type::psi_coeff_Y;
+                        // x and y are X and Y over powers of Z, so conjugating Z as well conjugates x and y
+                        conjugate_z(image, std::is_same<typename GroupValueType::coordinates, coordinates::affine>());
+                        return image;
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_ENDOMORPHISMS_HPP
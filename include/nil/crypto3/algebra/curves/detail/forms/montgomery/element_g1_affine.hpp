@@ -164,21 +164,19 @@ namespace nil {
 
                         /*************************  Reducing operations  ***********************************/
 
-                        // /** @brief
-                        //  *
-                        //  * See https://eprint.iacr.org/2017/212.pdf, p. 7, par. 3.
-                        //  *
-                        //  * @return return the corresponding element from affine coordinates to
-                        //  xz coordinates
-                        //  */
-                        // constexpr curve_element<params_type, form, typename curves::coordinates::xz> to_xz() const {
-                        //     using result_type = curve_element<params_type, form, typename curves::coordinates::xz>;
-                        //
-                        //     return this->is_zero() ? result_type(result_type::field_type::value_type::one(),
-                        //                                          result_type::field_type::value_type::zero()) :
-                        //                              result_type(this->X,
-                        //                              result_type::field_type::value_type::one());
-                        // }
+                        /** @brief
+                         *
+                         * See https://eprint.iacr.org/2017/212.pdf, p. 7, par. 3.
+                         *
+                         * @return return the corresponding element from affine coordinates to
+                         * xz coordinates
+                         */
+                        constexpr curve_element<params_type, form, typename curves::coordinates::xz> to_xz() const {
+                            using result_type = curve_element<params_type, form, typename curves::coordinates::xz>;
+
+                            return this->is_zero() ? result_type(field_value_type::one(), field_value_type::zero()) :
+                                                     result_type(this->X, field_value_type::one());
+                        }
 
                         /**
                          * @brief
@@ -0,0 +1,316 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_HPP
+#define CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_HPP
+
+#include <nil/crypto3/algebra/curves/detail/scalar_mul.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/dbl_1987_m_3.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/dadd_1987_m_3.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/montgomery/xz/ladd_1987_m_3.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/multiprecision/number.hpp>
+
+#include <cstdint>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing a group G1 of elliptic curve.
+                     *    @tparam CurveParams Parameters of the group
+                     *    @tparam Form Form of the curve
+                     *    @tparam Coordinates Representation coordinates of the group element
+                     */
+                    template<typename CurveParams, typename Form, typename Coordinates>
+                    class curve_element;
+
+                    /** @brief A struct representing an element from the group G1 of Montgomery curve of
+                     *  xz coordinates representation, i.e. x = X/Z, y is not tracked.
+                     *  Since P and -P share the same x-coordinate, only doubling and differential addition
+                     *  (P+Q given P, Q and P-Q) are available, which is enough for the Montgomery ladder.
+                     *  Description: https://hyperelliptic.org/EFD/g1p/auto-montgom-xz.html
+                     *
+                     */
+                    template<typename CurveParams>
+                    class curve_element<CurveParams, forms::montgomery, coordinates::xz> {
+                    public:
+                        using params_type = CurveParams;
+                        using field_type = typename params_type::field_type;
+
+                    private:
+                        using field_value_type = typename field_type::value_type;
+
+                        using common_doubling_processor = montgomery_element_g1_xz_dbl_1987_m_3;
+                        using differential_addition_processor = montgomery_element_g1_xz_dadd_1987_m_3;
+                        using ladder_step_processor = montgomery_element_g1_xz_ladd_1987_m_3;
+
+                    public:
+                        using form = forms::montgomery;
+                        using coordinates = coordinates::xz;
+
+                        using group_type = typename params_type::template group_type<coordinates>;
+
+                        field_value_type X;
+                        field_value_type Z;
+
+                        /*************************  Constructors and zero/one  ***********************************/
+
+                        /** @brief
+                         *    @return the point at infinity by default
+                         *
+                         */
+                        constexpr curve_element() :
+                            curve_element(field_value_type::one(), field_value_type::zero()) {
+                        }
+
+                        /** @brief
+                         *    @return the selected point (X:Z)
+                         *
+                         */
+                        constexpr curve_element(const field_value_type &X, const field_value_type &Z) : X(X), Z(Z) {
+                        }
+
+                        template<typename Backend,
+                                 boost::multiprecision::expression_template_option ExpressionTemplates>
+                        explicit constexpr curve_element(
+                            const boost::multiprecision::number<Backend, ExpressionTemplates> &value) {
+                            *this = one() * value;
+                        }
+
+                        /** @brief Get the point at infinity
+                         *
+                         */
+                        constexpr static curve_element zero() {
+                            return curve_element();
+                        }
+
+                        /** @brief Get the generator of group G1
+                         *
+                         */
+                        constexpr static curve_element one() {
+                            return curve_element(params_type::one_fill[0], field_value_type::one());
+                        }
+
+                        /*************************  Comparison operations  ***********************************/
+
+                        constexpr bool operator==(const curve_element &other) const {
+                            if (this->is_zero()) {
+                                return other.is_zero();
+                            }
+
+                            if (other.is_zero()) {
+                                return false;
+                            }
+
+                            /* now neither is O */
+
+                            // X1/Z1 = X2/Z2 <=> X1*Z2 = X2*Z1
+                            return (this->X * other.Z) == (other.X * this->Z);
+                        }
+
+                        constexpr bool operator!=(const curve_element &other) const {
+                            return !(operator==(other));
+                        }
+
+                        /** @brief
+                         *
+                         * @return true if element from group G1 is the point at infinity
+                         */
+                        constexpr bool is_zero() const {
+                            return this->Z.is_zero();
+                        }
+
+                        /** @brief
+                         *
+                         * @return true if x = X/Z is an x-coordinate of a point on the elliptic curve
+                         * B*y^2 = x^3 + A*x^2 + x, i.e. B*X*Z*(X^2 + A*X*Z + Z^2) is a square
+                         * */
+                        constexpr bool is_well_formed() const {
+                            if (this->is_zero()) {
+                                return true;
+                            }
+
+                            const field_value_type XZ = this->X * this->Z;
+                            return (field_value_type(params_type::B) * XZ *
+                                    (this->X.squared() + field_value_type(params_type::A) * XZ + this->Z.squared()))
+                                .is_square();
+                        }
+
+                        /*************************  Reducing operations  ***********************************/
+
+                        /** @brief
+                         *
+                         * @return the affine x-coordinate x = X/Z, zero for the point at infinity as in RFC 7748
+                         */
+                        constexpr field_value_type to_affine_x() const {
+                            if (is_zero()) {
+                                return field_value_type::zero();
+                            }
+
+                            return X * Z.inversed();
+                        }
+
+                        /*************************  Arithmetic operations  ***********************************/
+
+                        constexpr curve_element operator=(const curve_element &other) {
+                            this->X = other.X;
+                            this->Z = other.Z;
+
+                            return *this;
+                        }
+
+                        template<typename Backend,
+                                 boost::multiprecision::expression_template_option ExpressionTemplates>
+                        constexpr const curve_element &operator=(
+                            const boost::multiprecision::number<Backend, ExpressionTemplates> &value) {
+                            *this = one() * value;
+                            return *this;
+                        }
+
+                        /** @brief
+                         *
+                         * x-coordinates of P and -P coincide, so negation does not change the element.
+                         * @return negative element from group G1
+                         */
+                        constexpr curve_element operator-() const {
+                            return *this;
+                        }
+
+                        /** @brief
+                         *
+                         * @return doubled element from group G1
+                         */
+                        constexpr void double_inplace() {
+                            common_doubling_processor::process(*this);
+                        }
+
+                        /** @brief
+                         *
+                         * Differential addition, the difference (*this - other) has to be known and not O.
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr void differential_add(const curve_element &other, const curve_element &difference) {
+                            differential_addition_processor::process(*this, other, difference);
+                        }
+
+                        /** @brief
+                         *
+                         * Montgomery ladder step: (R0, R1) -> (2*R0, R0+R1), where R1 - R0 = difference.
+                         */
+                        constexpr static void ladder_step(curve_element &R0, curve_element &R1,
+                                                          const curve_element &difference) {
+                            ladder_step_processor::process(R0, R1, difference);
+                        }
+
+                        friend std::ostream &operator<<(std::ostream &os, curve_element const &e) {
+                            os << "{\"X\":" << e.X << ",\"Z\":" << e.Z << "}";
+                            return os;
+                        }
+                    };
+
+                    /** @brief Swaps the elements if mask is one and keeps them if mask is zero without branching
+                     *  on the mask.
+                     */
+                    template<typename FieldValueType>
+                    constexpr void montgomery_ladder_cswap(FieldValueType &first, FieldValueType &second,
+                                                           const FieldValueType &mask) {
+                        const FieldValueType t = mask * (first - second);
+                        first -= t;
+                        second += t;
+                    }
+
+                    /** @brief Constant-time Montgomery ladder, processes a fixed number of bits of the scalar
+                     *  (the bit length of the base field modulus) independently of its value.
+                     *  The scalar must fit in that many bits, as the X25519 scalars of RFC 7748 do.
+                     *  See https://datatracker.ietf.org/doc/html/rfc7748#section-5
+                     *
+                     * @return scalar * base in xz coordinates
+                     */
+                    template<typename CurveParams,
+                             typename Backend,
+                             boost::multiprecision::expression_template_option ExpressionTemplates>
+                    constexpr curve_element<CurveParams, forms::montgomery, coordinates::xz>
+                        montgomery_ladder(const curve_element<CurveParams, forms::montgomery, coordinates::xz> &base,
+                                          const boost::multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                        using element_type = curve_element<CurveParams, forms::montgomery, coordinates::xz>;
+                        using field_value_type = typename element_type::field_type::value_type;
+
+                        BOOST_ASSERT_MSG(scalar.is_zero() || boost::multiprecision::msb(scalar) <
+                                                                   element_type::field_type::modulus_bits,
+                                         "the scalar is wider than the ladder");
+
+                        element_type R0 = element_type::zero();
+                        element_type R1 = base;
+
+                        bool swap = false;
+                        for (auto i = static_cast<std::int64_t>(element_type::field_type::modulus_bits) - 1; i >= 0;
+                             --i) {
+                            const bool bit = boost::multiprecision::bit_test(scalar, i);
+                            const field_value_type mask(static_cast<unsigned>(swap ^ bit));
+                            montgomery_ladder_cswap(R0.X, R1.X, mask);
+                            montgomery_ladder_cswap(R0.Z, R1.Z, mask);
+                            swap = bit;
+
+                            element_type::ladder_step(R0, R1, base);
+                        }
+                        const field_value_type mask(static_cast<unsigned>(swap));
+                        montgomery_ladder_cswap(R0.X, R1.X, mask);
+                        montgomery_ladder_cswap(R0.Z, R1.Z, mask);
+
+                        return R0;
+                    }
+
+                    /** @brief Multiplication by a scalar of any width, the scalar is first reduced modulo the order
+                     *  of the prime-order subgroup, so base is assumed to lie in it.
+                     *
+                     * @return scalar * base in xz coordinates
+                     */
+                    template<typename CurveParams,
+                             typename Backend,
+                             boost::multiprecision::expression_template_option ExpressionTemplates>
+                    constexpr curve_element<CurveParams, forms::montgomery, coordinates::xz>
+                        scalar_mul(const curve_element<CurveParams, forms::montgomery, coordinates::xz> &base,
+                                   const boost::multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                        using element_type = curve_element<CurveParams, forms::montgomery, coordinates::xz>;
+                        using scalar_field_type = typename element_type::group_type::curve_type::scalar_field_type;
+                        using scalar_integral_type = typename scalar_field_type::integral_type;
+
+                        static_assert(scalar_field_type::modulus_bits <= element_type::field_type::modulus_bits,
+                                      "the reduced scalar has to fit in the ladder");
+
+                        return montgomery_ladder(base, typename scalar_field_type::value_type(scalar)
+                                                           .data.template convert_to<scalar_integral_type>());
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_MONTGOMERY_G1_ELEMENT_XZ_HPP
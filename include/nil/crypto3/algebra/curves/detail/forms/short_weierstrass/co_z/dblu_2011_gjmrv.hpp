@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_CO_Z_DBLU_2011_GJMRV_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_CO_Z_DBLU_2011_GJMRV_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief A struct representing initial co-Z doubling with update from the group G1 of short
+                     *  Weierstrass curve for Jacobian coordinates representation (any a4).
+                     *  Given P = (x1:y1:1), computes 2P and a representative of P sharing its Z:
+                     *  first <- 2P, second <- P.
+                     *  NOTE: does not handle O and pts of order 2, requires Z1 = 1
+                     *  R. R. Goundar, M. Joye, A. Miyaji, M. Rivain, A. Venelli,
+                     *  "Scalar multiplication on Weierstrass elliptic curves from Co-Z arithmetic", JCEN 2011
+                     */
+                    struct short_weierstrass_element_g1_co_z_dblu_2011_gjmrv {
+
+                        template<typename ElementType>
+                        constexpr static inline void process(ElementType &first, ElementType &second) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            field_value_type B = first.X.squared();               // B = X1^2
+                            field_value_type E = first.Y.squared();               // E = Y1^2
+                            field_value_type L = E.squared();                     // L = E^2
+                            field_value_type S = ((first.X + E).squared() - B - L).doubled();    // S = 2*((X1+E)^2-B-L)
+                            field_value_type M = B + B + B + field_value_type(ElementType::params_type::a);    // M = 3*B+a
+                            field_value_type eightL = L.doubled().doubled().doubled();
+
+                            field_value_type X3 = M.squared() - S.doubled();    // X3 = M^2-2*S
+                            field_value_type Y3 = M * (S - X3) - eightL;         // Y3 = M*(S-X3)-8*L
+                            field_value_type Z3 = first.Y.doubled();             // Z3 = 2*Y1
+
+                            second.X = S;         // X1' = S
+                            second.Y = eightL;    // Y1' = 8*L
+                            second.Z = Z3;
+
+                            first.X = X3;
+                            first.Y = Y3;
+                            first.Z = Z3;
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_CO_Z_DBLU_2011_GJMRV_HPP
@@ -0,0 +1,76 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_CO_Z_ZADDU_2007_M_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_CO_Z_ZADDU_2007_M_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief A struct representing co-Z element addition with update from the group G1 of short
+                     *  Weierstrass curve for Jacobian coordinates representation (any a4).
+                     *  Given P = (X1:Y1:Z) and Q = (X2:Y2:Z) sharing Z, computes P+Q and a representative of P
+                     *  with the same Z as the sum: first <- P+Q, second <- P.
+                     *  NOTE: does not handle O and the case P = +-Q
+                     *  N. Meloni, "New point addition formulae for ECC applications", WAIFI 2007
+                     */
+                    struct short_weierstrass_element_g1_co_z_zaddu_2007_m {
+
+                        template<typename ElementType>
+                        constexpr static inline void process(ElementType &first, ElementType &second) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            field_value_type X1mX2 = first.X - second.X;
+                            field_value_type C = X1mX2.squared();         // C = (X1-X2)^2
+                            field_value_type W1 = first.X * C;            // W1 = X1*C
+                            field_value_type W2 = second.X * C;           // W2 = X2*C
+                            field_value_type Y1mY2 = first.Y - second.Y;
+                            field_value_type D = Y1mY2.squared();         // D = (Y1-Y2)^2
+                            field_value_type A1 = first.Y * (W1 - W2);    // A1 = Y1*(W1-W2)
+
+                            field_value_type X3 = D - W1 - W2;               // X3 = D-W1-W2
+                            field_value_type Y3 = Y1mY2 * (W1 - X3) - A1;    // Y3 = (Y1-Y2)*(W1-X3)-A1
+                            field_value_type Z3 = first.Z * X1mX2;           // Z3 = Z*(X1-X2)
+
+                            second.X = W1;    // X1' = W1
+                            second.Y = A1;    // Y1' = A1
+                            second.Z = Z3;
+
+                            first.X = X3;
+                            first.Y = Y3;
+                            first.Z = Z3;
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_CO_Z_ZADDU_2007_M_HPP
@@ -0,0 +1,85 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_ADD_2015_RCB_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_ADD_2015_RCB_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief A struct representing complete element addition from the group G1 of short Weierstrass
+                     *  curve for projective coordinates representation (any a4, odd order).
+                     *  Handles O = (0:1:0), doubling and P + (-P) without branches.
+                     *  J. Renes, C. Costello, L. Batina, "Complete addition formulas for prime order elliptic
+                     *  curves", https://eprint.iacr.org/2015/1060, Algorithm 1
+                     */
+                    struct short_weierstrass_element_g1_projective_add_2015_rcb {
+
+                        template<typename ElementType>
+                        constexpr static inline void process(ElementType &first, const ElementType &second) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            const field_value_type a(ElementType::params_type::a);
+                            const field_value_type b3 = 3u * field_value_type(ElementType::params_type::b);
+
+                            field_value_type t0 = first.X * second.X;
+                            field_value_type t1 = first.Y * second.Y;
+                            field_value_type t2 = first.Z * second.Z;
+                            field_value_type t3 = (first.X + first.Y) * (second.X + second.Y) - t0 - t1;
+                            field_value_type t4 = (first.X + first.Z) * (second.X + second.Z) - t0 - t2;
+                            field_value_type t5 = (first.Y + first.Z) * (second.Y + second.Z) - t1 - t2;
+
+                            field_value_type Z3 = a * t4 + b3 * t2;
+                            field_value_type X3 = t1 - Z3;
+                            Z3 = t1 + Z3;
+                            field_value_type Y3 = X3 * Z3;
+
+                            t1 = t0 + t0 + t0;
+                            t2 = a * t2;
+                            t4 = b3 * t4;
+                            t1 = t1 + t2;
+                            t2 = a * (t0 - t2);
+                            t4 = t4 + t2;
+
+                            Y3 = Y3 + t1 * t4;
+                            X3 = t3 * X3 - t5 * t4;
+                            Z3 = t5 * Z3 + t3 * t1;
+
+                            first.X = X3;
+                            first.Y = Y3;
+                            first.Z = Z3;
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_ADD_2015_RCB_HPP
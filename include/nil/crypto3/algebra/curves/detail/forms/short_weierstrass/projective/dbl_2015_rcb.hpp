@@ -0,0 +1,83 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_DBL_2015_RCB_HPP
+#define CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_DBL_2015_RCB_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief A struct representing complete element doubling from the group G1 of short Weierstrass
+                     *  curve for projective coordinates representation (any a4, odd order).
+                     *  Handles O = (0:1:0) without branches.
+                     *  J. Renes, C. Costello, L. Batina, "Complete addition formulas for prime order elliptic
+                     *  curves", https://eprint.iacr.org/2015/1060, Algorithm 3
+                     */
+                    struct short_weierstrass_element_g1_projective_dbl_2015_rcb {
+
+                        template<typename ElementType>
+                        constexpr static inline void process(ElementType &first) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            const field_value_type a(ElementType::params_type::a);
+                            const field_value_type b3 = 3u * field_value_type(ElementType::params_type::b);
+
+                            field_value_type t0 = first.X.squared();
+                            field_value_type t1 = first.Y.squared();
+                            field_value_type t2 = first.Z.squared();
+                            field_value_type t3 = (first.X * first.Y).doubled();
+                            field_value_type Z3 = (first.X * first.Z).doubled();
+
+                            field_value_type Y3 = a * Z3 + b3 * t2;
+                            field_value_type X3 = t1 - Y3;
+                            Y3 = X3 * (t1 + Y3);
+                            X3 = t3 * X3;
+                            Z3 = b3 * Z3;
+
+                            t2 = a * t2;
+                            t3 = a * (t0 - t2) + Z3;
+                            t0 = t0 + t0 + t0 + t2;
+                            Y3 = Y3 + t0 * t3;
+
+                            t2 = (first.Y * first.Z).doubled();
+                            X3 = X3 - t2 * t3;
+                            Z3 = (t2 * t1).doubled().doubled();
+
+                            first.X = X3;
+                            first.Y = Y3;
+                            first.Z = Z3;
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_SHORT_WEIERSTRASS_G1_ELEMENT_PROJECTIVE_DBL_2015_RCB_HPP
@@ -0,0 +1,132 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_ADD_CACHED_2008_HWCD_3_HPP
+#define CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_ADD_CACHED_2008_HWCD_3_HPP
+
+#include <boost/assert.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief A struct representing element addition from the group G1 of twisted Edwards curve
+                     *  for extended coordinates with a=-1 representation, where the second operand is given in
+                     *  the cached (Y+X, Y-X, 2*d*T, 2*Z) form. Costs 8M instead of 9M of add-2008-hwcd-3 since
+                     *  the multiplication by 2*d is precomputed.
+                     *  The formulas are complete for a=-1 and non-square d, so no special cases are handled.
+                     *  https://hyperelliptic.org/EFD/g1p/auto-twisted-extended-1.html#addition-add-2008-hwcd-3
+                     *  https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.4
+                     */
+                    struct twisted_edwards_element_g1_extended_with_a_minus_1_add_cached_2008_hwcd_3 {
+
+                        template<typename ElementType, typename CachedElementType>
+                        constexpr static inline void process(ElementType &first,
+                                                             const CachedElementType &second) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            field_value_type A = (first.Y - first.X) * second.YminusX;    // A = (Y1-X1)*(Y2-X2)
+                            field_value_type B = (first.Y + first.X) * second.YplusX;     // B = (Y1+X1)*(Y2+X2)
+                            field_value_type C = first.T * second.T2d;                    // C = T1*2*d*T2
+                            field_value_type D = first.Z * second.Z2;                     // D = Z1*2*Z2
+                            field_value_type E = B - A;                                   // E = B-A
+                            field_value_type F = D - C;                                   // F = D-C
+                            field_value_type G = D + C;                                   // G = D+C
+                            field_value_type H = B + A;                                   // H = B+A
+
+                            first.X = E * F;    // X3 = E*F
+                            first.Y = G * H;    // Y3 = G*H
+                            first.T = E * H;    // T3 = E*H
+                            first.Z = F * G;    // Z3 = F*G
+                        }
+                    };
+
+                    /** @brief A struct representing mixed element addition from the group G1 of twisted Edwards
+                     *  curve for extended coordinates with a=-1 representation, where the second operand is given
+                     *  in the cached form built from an affine point, i.e. Z2 = 1. The product Z1*2*Z2 turns into
+                     *  a doubling, so the cost is 7M.
+                     */
+                    struct twisted_edwards_element_g1_extended_with_a_minus_1_madd_cached_2008_hwcd_3 {
+
+                        template<typename ElementType, typename CachedElementType>
+                        constexpr static inline void process(ElementType &first,
+                                                             const CachedElementType &second) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            BOOST_ASSERT(second.Z2 == field_value_type(2u));
+
+                            field_value_type A = (first.Y - first.X) * second.YminusX;    // A = (Y1-X1)*(Y2-X2)
+                            field_value_type B = (first.Y + first.X) * second.YplusX;     // B = (Y1+X1)*(Y2+X2)
+                            field_value_type C = first.T * second.T2d;                    // C = T1*2*d*T2
+                            field_value_type D = first.Z.doubled();                       // D = 2*Z1
+                            field_value_type E = B - A;                                   // E = B-A
+                            field_value_type F = D - C;                                   // F = D-C
+                            field_value_type G = D + C;                                   // G = D+C
+                            field_value_type H = B + A;                                   // H = B+A
+
+                            first.X = E * F;    // X3 = E*F
+                            first.Y = G * H;    // Y3 = G*H
+                            first.T = E * H;    // T3 = E*H
+                            first.Z = F * G;    // Z3 = F*G
+                        }
+                    };
+
+                    /** @brief A struct representing element subtraction from the group G1 of twisted Edwards curve
+                     *  for extended coordinates with a=-1 representation, where the second operand is given in
+                     *  the cached form. Negation of the cached point is folded into the formulas: Y+X and Y-X
+                     *  swap places and the sign of 2*d*T flips, so the cost is the same 8M.
+                     */
+                    struct twisted_edwards_element_g1_extended_with_a_minus_1_sub_cached_2008_hwcd_3 {
+
+                        template<typename ElementType, typename CachedElementType>
+                        constexpr static inline void process(ElementType &first,
+                                                             const CachedElementType &second) {
+
+                            using field_value_type = typename ElementType::field_type::value_type;
+
+                            field_value_type A = (first.Y - first.X) * second.YplusX;     // A = (Y1-X1)*(Y2+X2)
+                            field_value_type B = (first.Y + first.X) * second.YminusX;    // B = (Y1+X1)*(Y2-X2)
+                            field_value_type C = first.T * second.T2d;                    // C = T1*2*d*T2
+                            field_value_type D = first.Z * second.Z2;                     // D = Z1*2*Z2
+                            field_value_type E = B - A;                                   // E = B-A
+                            field_value_type F = D + C;                                   // F = D+C
+                            field_value_type G = D - C;                                   // G = D-C
+                            field_value_type H = B + A;                                   // H = B+A
+
+                            first.X = E * F;    // X3 = E*F
+                            first.Y = G * H;    // Y3 = G*H
+                            first.T = E * H;    // T3 = E*H
+                            first.Z = F * G;    // Z3 = F*G
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_ADD_CACHED_2008_HWCD_3_HPP
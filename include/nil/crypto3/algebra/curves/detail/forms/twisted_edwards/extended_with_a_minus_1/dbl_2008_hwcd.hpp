@@ -45,21 +45,19 @@ namespace nil {
 
                             using field_value_type = typename ElementType::field_type::value_type;
 
-                            if (!first.is_zero()) {
-
-                                field_value_type A = (first.X).squared();                        // A = X1^2
-                                field_value_type B = (first.Y).squared();                        // B = Y1^2
-                                field_value_type C = field_value_type(2u) * first.Z.squared();   // C = 2*Z1^2
-                                field_value_type D = ElementType::params_type::a * A;            // D = a*A
-                                field_value_type E = (first.X + first.Y).squared() - A - B;      // E = (X1+Y1)^2-A-B
-                                field_value_type G = D + B;                                      // G = D+B
-                                field_value_type F = G - C;                                      // F = G-C
-                                field_value_type H = D - B;                                      // H = D-B
-                                first.X = E * F;                                     // X3 = E*F
-                                first.Y = G * H;                                     // Y3 = G*H
-                                first.T = E * H;                                     // T3 = E*H
-                                first.Z = F * G;                                     // Z3 = F*G
-                            }
+                            // the formulas are complete, O = (0:1:0:1) is mapped to itself
+                            field_value_type A = (first.X).squared();                        // A = X1^2
+                            field_value_type B = (first.Y).squared();                        // B = Y1^2
+                            field_value_type C = field_value_type(2u) * first.Z.squared();   // C = 2*Z1^2
+                            field_value_type D = ElementType::params_type::a * A;            // D = a*A
+                            field_value_type E = (first.X + first.Y).squared() - A - B;      // E = (X1+Y1)^2-A-B
+                            field_value_type G = D + B;                                      // G = D+B
+                            field_value_type F = G - C;                                      // F = G-C
+                            field_value_type H = D - B;                                      // H = D-B
+                            first.X = E * F;                                     // X3 = E*F
+                            first.Y = G * H;                                     // Y3 = G*H
+                            first.T = E * H;                                     // T3 = E*H
+                            first.Z = F * G;                                     // Z3 = F*G
                         }
                     };
 
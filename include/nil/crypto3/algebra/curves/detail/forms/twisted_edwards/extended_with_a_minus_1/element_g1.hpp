@@ -33,6 +33,8 @@
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/add_2008_hwcd_3.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/dbl_2008_hwcd.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/madd_2008_hwcd_2.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/add_cached_2008_hwcd_3.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/element_g1_cached.hpp>
 #include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/element_g1_affine.hpp>
 
 namespace nil {
@@ -69,6 +71,12 @@ namespace nil {
                             twisted_edwards_element_g1_extended_with_a_minus_1_dbl_2008_hwcd;
                         using mixed_addition_processor =
                             twisted_edwards_element_g1_extended_with_a_minus_1_madd_2008_hwcd_2;
+                        using cached_addition_processor =
+                            twisted_edwards_element_g1_extended_with_a_minus_1_add_cached_2008_hwcd_3;
+                        using cached_mixed_addition_processor =
+                            twisted_edwards_element_g1_extended_with_a_minus_1_madd_cached_2008_hwcd_3;
+                        using cached_subtraction_processor =
+                            twisted_edwards_element_g1_extended_with_a_minus_1_sub_cached_2008_hwcd_3;
 
                     public:
                         using form = forms::twisted_edwards;
@@ -76,6 +84,8 @@ namespace nil {
 
                         using group_type = typename params_type::template group_type<coordinates>;
 
+                        using cached_type = twisted_edwards_element_g1_extended_with_a_minus_1_cached<params_type>;
+
                         field_value_type X;
                         field_value_type Y;
                         field_value_type T;
@@ -211,6 +221,15 @@ namespace nil {
                             return result_type(X * Zi, Y * Zi);    //  x=X/Z, y=Y/Z
                         }
 
+                        /** @brief
+                         *
+                         * @return return the corresponding element in the cached (Y+X, Y-X, 2*d*T, 2*Z) form,
+                         * suitable for repeated additions of the same point
+                         */
+                        constexpr cached_type to_cached() const {
+                            return cached_type::from_extended(*this);
+                        }
+
                         /*************************  Arithmetic operations  ***********************************/
 
                         constexpr curve_element operator=(const curve_element &other) {
@@ -305,6 +324,57 @@ namespace nil {
                             mixed_addition_processor::process(*this, other);
                         }
 
+                        /** @brief
+                         *
+                         * Addition of the element given in the cached form. The underlying formulas are complete,
+                         * so neither of the operands is checked for being O.
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr void add_cached(const cached_type &other) {
+                            cached_addition_processor::process(*this, other);
+                        }
+
+                        /** @brief
+                         *
+                         * Mixed addition of the element given in the cached form, the cached element is
+                         * required to be built from an element with Z = 1.
+                         * @return addition of two elements from group G1
+                         */
+                        constexpr void mixed_add_cached(const cached_type &other) {
+                            cached_mixed_addition_processor::process(*this, other);
+                        }
+
+                        /** @brief
+                         *
+                         * Subtraction of the element given in the cached form.
+                         * @return difference of two elements from group G1
+                         */
+                        constexpr void sub_cached(const cached_type &other) {
+                            cached_subtraction_processor::process(*this, other);
+                        }
+
+                        constexpr curve_element operator+(const cached_type &other) const {
+                            curve_element result = *this;
+                            result.add_cached(other);
+                            return result;
+                        }
+
+                        constexpr curve_element& operator+=(const cached_type &other) {
+                            add_cached(other);
+                            return *this;
+                        }
+
+                        constexpr curve_element operator-(const cached_type &other) const {
+                            curve_element result = *this;
+                            result.sub_cached(other);
+                            return result;
+                        }
+
+                        constexpr curve_element& operator-=(const cached_type &other) {
+                            sub_cached(other);
+                            return *this;
+                        }
+
                         friend std::ostream& operator<<(std::ostream& os, curve_element const& e)
                         {
                             os << "{\"X\":" << e.X << ",\"Y\":" << e.Y
@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_CACHED_HPP
+#define CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_CACHED_HPP
+
+#include <ostream>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+
+                    /** @brief A struct representing a precomputed ("cached", a.k.a. Niels) form of an element from
+                     *  the group G1 of twisted Edwards curve for extended coordinates with a=-1 representation.
+                     *  Stores (Y+X, Y-X, 2*d*T, 2*Z), so that the values depending only on the second operand
+                     *  of the addition are computed once and reused for every addition of the same point, as
+                     *  happens with table points in windowed scalar multiplication and multiexponentiation.
+                     *  https://datatracker.ietf.org/doc/html/rfc8032#section-5.1.4
+                     *    @tparam CurveParams Parameters of the group
+                     */
+                    template<typename CurveParams>
+                    struct twisted_edwards_element_g1_extended_with_a_minus_1_cached {
+                        using params_type = CurveParams;
+                        using field_type = typename params_type::field_type;
+
+                    private:
+                        using field_value_type = typename field_type::value_type;
+
+                    public:
+                        field_value_type YplusX;
+                        field_value_type YminusX;
+                        field_value_type T2d;
+                        field_value_type Z2;
+
+                        /** @brief
+                         *    @return the cached form of the point at infinity by default
+                         *
+                         */
+                        constexpr twisted_edwards_element_g1_extended_with_a_minus_1_cached() :
+                            YplusX(field_value_type::one()), YminusX(field_value_type::one()),
+                            T2d(field_value_type::zero()), Z2(field_value_type(2u)) {
+                        }
+
+                        constexpr twisted_edwards_element_g1_extended_with_a_minus_1_cached(
+                            const field_value_type &YplusX, const field_value_type &YminusX,
+                            const field_value_type &T2d, const field_value_type &Z2) :
+                            YplusX(YplusX),
+                            YminusX(YminusX), T2d(T2d), Z2(Z2) {
+                        }
+
+                        /** @brief Builds the cached form from the extended coordinates (X:Y:T:Z)
+                         *
+                         */
+                        template<typename ElementType>
+                        constexpr static twisted_edwards_element_g1_extended_with_a_minus_1_cached
+                            from_extended(const ElementType &p) {
+                            return twisted_edwards_element_g1_extended_with_a_minus_1_cached(
+                                p.Y + p.X, p.Y - p.X, p.T * field_value_type(params_type::d).doubled(),
+                                p.Z.doubled());
+                        }
+
+                        /** @brief
+                         *
+                         * @return cached form of the negated element: (Y-X, Y+X, -2*d*T, 2*Z)
+                         */
+                        constexpr twisted_edwards_element_g1_extended_with_a_minus_1_cached operator-() const {
+                            return twisted_edwards_element_g1_extended_with_a_minus_1_cached(YminusX, YplusX, -T2d,
+                                                                                             Z2);
+                        }
+
+                        constexpr bool operator==(const twisted_edwards_element_g1_extended_with_a_minus_1_cached &other) const {
+                            // All the components are homogeneous of degree one in the projective factor
+                            return (YplusX * other.Z2 == other.YplusX * Z2) && (YminusX * other.Z2 == other.YminusX * Z2) &&
+                                   (T2d * other.Z2 == other.T2d * Z2);
+                        }
+
+                        constexpr bool operator!=(const twisted_edwards_element_g1_extended_with_a_minus_1_cached &other) const {
+                            return !(operator==(other));
+                        }
+
+                        friend std::ostream &operator<<(std::ostream &os,
+                                                        twisted_edwards_element_g1_extended_with_a_minus_1_cached const &e) {
+                            os << "{\"YplusX\":" << e.YplusX << ",\"YminusX\":" << e.YminusX << ",\"T2d\":" << e.T2d
+                               << ",\"Z2\":" << e.Z2 << "}";
+                            return os;
+                        }
+                    };
+
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_CURVES_TWISTED_EDWARDS_G1_ELEMENT_EXTENDED_WITH_A_MINUS_1_CACHED_HPP
@@ -0,0 +1,235 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_EXPAND_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_EXPAND_HPP
+
+#include <boost/assert.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief SHA-256 of FIPS 180-4, the H of the XMD:SHA-256 hash-to-curve suites.
+                     *
+                     *  Only what expand_message_xmd needs: absorb bytes, then take the digest once.
+                     */
+                    class sha2_256 {
+                    public:
+                        constexpr static const std::size_t block_size = 64;     ///< s_in_bytes of RFC 9380
+                        constexpr static const std::size_t digest_size = 32;    ///< b_in_bytes of RFC 9380
+
+                        typedef std::array<std::uint8_t, digest_size> digest_type;
+
+                        sha2_256() :
+                            state {{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab,
+                                    0x5be0cd19}},
+                            block(), filled(0), length(0) {
+                        }
+
+                        inline void update(std::uint8_t byte) {
+                            block[filled++] = byte;
+                            ++length;
+                            if (filled == block_size) {
+                                process_block();
+                            }
+                        }
+
+                        template<typename InputIterator>
+                        inline void update(InputIterator first, InputIterator last) {
+                            for (; first != last; ++first) {
+                                update(static_cast<std::uint8_t>(*first));
+                            }
+                        }
+
+                        /// Pads the message and returns its digest, the object must not be updated afterwards
+                        inline digest_type digest() {
+                            const std::uint64_t length_bits = length * 8;
+
+                            update(0x80);
+                            while (filled != block_size - 8) {
+                                update(0x00);
+                            }
+                            for (std::size_t i = 8; i-- > 0;) {
+                                update(static_cast<std::uint8_t>(length_bits >> (8 * i)));
+                            }
+
+                            digest_type result;
+                            for (std::size_t i = 0; i < state.size(); ++i) {
+                                for (std::size_t j = 0; j < 4; ++j) {
+                                    result[4 * i + j] = static_cast<std::uint8_t>(state[i] >> (24 - 8 * j));
+                                }
+                            }
+                            return result;
+                        }
+
+                    private:
+                        static inline std::uint32_t rotr(std::uint32_t x, std::size_t n) {
+                            return (x >> n) | (x << (32 - n));
+                        }
+
+                        inline void process_block() {
+                            constexpr static const std::uint32_t round_constants[64] = {
+                                0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+                                0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+                                0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+                                0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+                                0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+                                0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+                                0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+                                0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                                0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+                                0xc67178f2};
+
+                            std::array<std::uint32_t, 64> w;
+                            for (std::size_t i = 0; i < 16; ++i) {
+                                w[i] = (std::uint32_t(block[4 * i]) << 24) | (std::uint32_t(block[4 * i + 1]) << 16) |
+                                       (std::uint32_t(block[4 * i + 2]) << 8) | std::uint32_t(block[4 * i + 3]);
+                            }
+                            for (std::size_t i = 16; i < 64; ++i) {
+                                const std::uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                                const std::uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                                w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+                            }
+
+                            std::array<std::uint32_t, 8> v = state;
+                            for (std::size_t i = 0; i < 64; ++i) {
+                                const std::uint32_t s1 = rotr(v[4], 6) ^ rotr(v[4], 11) ^ rotr(v[4], 25);
+                                const std::uint32_t ch = (v[4] & v[5]) ^ (~v[4] & v[6]);
+                                const std::uint32_t t1 = v[7] + s1 + ch + round_constants[i] + w[i];
+                                const std::uint32_t s0 = rotr(v[0], 2) ^ rotr(v[0], 13) ^ rotr(v[0], 22);
+                                const std::uint32_t maj = (v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]);
+                                const std::uint32_t t2 = s0 + maj;
+
+                                v[7] = v[6];
+                                v[6] = v[5];
+                                v[5] = v[4];
+                                v[4] = v[3] + t1;
+                                v[3] = v[2];
+                                v[2] = v[1];
+                                v[1] = v[0];
+                                v[0] = t1 + t2;
+                            }
+                            for (std::size_t i = 0; i < state.size(); ++i) {
+                                state[i] += v[i];
+                            }
+                            filled = 0;
+                        }
+
+                        std::array<std::uint32_t, 8> state;
+                        std::array<std::uint8_t, block_size> block;
+                        std::size_t filled;
+                        std::uint64_t length;
+                    };
+
+                    /** @brief expand_message_xmd of RFC 9380 5.3.1, len_in_bytes uniform bytes out of msg and DST.
+                     *
+                     *  DSTs longer than 255 bytes are first hashed as in RFC 9380 5.3.3.
+                     */
+                    template<typename HashType>
+                    struct expand_message_xmd {
+                        typedef HashType hash_type;
+                        typedef typename hash_type::digest_type digest_type;
+
+                        constexpr static const std::size_t b_in_bytes = hash_type::digest_size;
+                        constexpr static const std::size_t s_in_bytes = hash_type::block_size;
+
+                        template<typename MsgRange, typename DstRange>
+                        static inline std::vector<std::uint8_t> process(const MsgRange &msg, const DstRange &dst,
+                                                                        std::size_t len_in_bytes) {
+                            const std::size_t ell = (len_in_bytes + b_in_bytes - 1) / b_in_bytes;
+                            BOOST_ASSERT_MSG(ell <= 255 && len_in_bytes <= 65535, "too many bytes requested");
+
+                            const std::vector<std::uint8_t> dst_prime = make_dst_prime(dst);
+
+                            hash_type b_0_hash;
+                            for (std::size_t i = 0; i < s_in_bytes; ++i) {
+                                b_0_hash.update(0x00);
+                            }
+                            b_0_hash.update(std::cbegin(msg), std::cend(msg));
+                            b_0_hash.update(static_cast<std::uint8_t>(len_in_bytes >> 8));
+                            b_0_hash.update(static_cast<std::uint8_t>(len_in_bytes));
+                            b_0_hash.update(0x00);
+                            b_0_hash.update(dst_prime.cbegin(), dst_prime.cend());
+                            const digest_type b_0 = b_0_hash.digest();
+
+                            std::vector<std::uint8_t> uniform_bytes;
+                            uniform_bytes.reserve(ell * b_in_bytes);
+
+                            // b_i = H((b_0 xor b_(i - 1)) || I2OSP(i, 1) || DST_prime), with b_0 xor b_0 = 0 for i = 1
+                            digest_type b_i = {};
+                            for (std::size_t i = 1; i <= ell; ++i) {
+                                hash_type b_i_hash;
+                                for (std::size_t j = 0; j < b_in_bytes; ++j) {
+                                    b_i_hash.update(static_cast<std::uint8_t>(b_0[j] ^ b_i[j]));
+                                }
+                                b_i_hash.update(static_cast<std::uint8_t>(i));
+                                b_i_hash.update(dst_prime.cbegin(), dst_prime.cend());
+                                b_i = b_i_hash.digest();
+
+                                uniform_bytes.insert(uniform_bytes.end(), b_i.cbegin(), b_i.cend());
+                            }
+                            uniform_bytes.resize(len_in_bytes);
+
+                            return uniform_bytes;
+                        }
+
+                    private:
+                        /// DST || I2OSP(len(DST), 1)
+                        template<typename DstRange>
+                        static inline std::vector<std::uint8_t> make_dst_prime(const DstRange &dst) {
+                            std::vector<std::uint8_t> dst_prime;
+                            const std::size_t dst_size = std::distance(std::cbegin(dst), std::cend(dst));
+                            if (dst_size > 255) {
+                                static const char oversize_prefix[] = "H2C-OVERSIZE-DST-";
+
+                                hash_type dst_hash;
+                                dst_hash.update(std::cbegin(oversize_prefix), std::cend(oversize_prefix) - 1);
+                                dst_hash.update(std::cbegin(dst), std::cend(dst));
+                                const digest_type short_dst = dst_hash.digest();
+                                dst_prime.assign(short_dst.cbegin(), short_dst.cend());
+                            } else {
+                                for (auto it = std::cbegin(dst); it != std::cend(dst); ++it) {
+                                    dst_prime.push_back(static_cast<std::uint8_t>(*it));
+                                }
+                            }
+                            dst_prime.push_back(static_cast<std::uint8_t>(dst_prime.size()));
+                            return dst_prime;
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_EXPAND_HPP
@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_FUNCTIONS_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_FUNCTIONS_HPP
+
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_suites.hpp>
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_m2c.hpp>
+#include <nil/crypto3/algebra/curves/detail/clear_cofactor.hpp>
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+
+#include <array>
+#include <iterator>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /// The encodings of RFC 9380 3 for the suite of GroupType
+                    template<typename GroupType>
+                    struct h2c {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        /// hash_to_curve, the _RO_ suite: a random oracle to the group
+                        template<typename MsgRange, typename DstRange>
+                        static inline group_value_type hash_to_curve(const MsgRange &msg, const DstRange &dst) {
+                            const std::array<field_value_type, 2> u =
+                                hash_to_field<GroupType>::template process<2>(msg, dst);
+
+                            return clear_cofactor(map_to_curve<GroupType>::process(u[0]) +
+                                                  map_to_curve<GroupType>::process(u[1]));
+                        }
+
+                        /// encode_to_curve, the _NU_ suite: nonuniform, cheaper, not a random oracle
+                        template<typename MsgRange, typename DstRange>
+                        static inline group_value_type encode_to_curve(const MsgRange &msg, const DstRange &dst) {
+                            const std::array<field_value_type, 1> u =
+                                hash_to_field<GroupType>::template process<1>(msg, dst);
+
+                            return clear_cofactor(map_to_curve<GroupType>::process(u[0]));
+                        }
+
+                        /// hash_to_curve of each message in [first, last), written to out as affine points.
+                        /// The messages are split across threads_count threads, the normalization to affine
+                        /// takes one inversion for all of them.
+                        template<typename MsgRandomAccessIterator, typename DstRange,
+                                 typename AffineRandomAccessIterator>
+                        static void batch_hash_to_curve(MsgRandomAccessIterator first, MsgRandomAccessIterator last,
+                                                        const DstRange &dst, AffineRandomAccessIterator out,
+                                                        std::size_t threads_count) {
+                            const std::size_t size = std::distance(first, last);
+                            std::vector<group_value_type> points(size);
+
+                            nil::marshalling::detail::parallel_chunks(
+                                size, threads_count, [first, &dst, &points](std::size_t begin, std::size_t end) {
+                                    for (std::size_t i = begin; i < end; ++i) {
+                                        points[i] = hash_to_curve(first[i], dst);
+                                    }
+                                    return true;
+                                });
+
+                            to_affine(points, out);
+                        }
+
+                        static inline group_value_type clear_cofactor(const group_value_type &p) {
+                            return clear_cofactor(
+                                p, typename curves::detail::clear_cofactor_method<GroupType>::type());
+                        }
+
+                    private:
+                        typedef typename GroupType::params_type::template group_type<coordinates::affine>::value_type
+                            affine_value_type;
+
+                        static inline group_value_type clear_cofactor(const group_value_type &p,
+                                                                      clear_cofactor_methods::scalar_mul) {
+                            // prime order curves have h_eff = 1
+                            return suite_type::h_eff == 1 ? p : p * suite_type::h_eff;
+                        }
+
+                        template<typename Method>
+                        static inline group_value_type clear_cofactor(const group_value_type &p, Method method) {
+                            return curves::detail::clear_cofactor(p, method);
+                        }
+
+                        /// x = X / Z^2 and y = Y / Z^3 for all the points, with Montgomery's trick on the Z
+                        template<typename AffineRandomAccessIterator>
+                        static void to_affine(const std::vector<group_value_type> &points,
+                                              AffineRandomAccessIterator out) {
+                            std::vector<field_value_type> prefix_products(points.size());
+                            field_value_type product = field_value_type::one();
+                            for (std::size_t i = 0; i < points.size(); ++i) {
+                                prefix_products[i] = product;
+                                if (!points[i].is_zero()) {
+                                    product = product * points[i].Z;
+                                }
+                            }
+
+                            field_value_type product_inv = product.inversed();
+                            for (std::size_t i = points.size(); i-- > 0;) {
+                                if (points[i].is_zero()) {
+                                    out[i] = affine_value_type::zero();
+                                    continue;
+                                }
+                                const field_value_type Z_inv = product_inv * prefix_products[i];
+                                product_inv = product_inv * points[i].Z;
+
+                                const field_value_type Z_inv_squared = Z_inv.squared();
+                                out[i] = affine_value_type(points[i].X * Z_inv_squared,
+                                                           points[i].Y * Z_inv_squared * Z_inv);
+                            }
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_FUNCTIONS_HPP
@@ -29,14 +29,97 @@
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_suites.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace curves {
                 namespace detail {
+                    /** @brief Evaluation of an isogeny (x, y) -> (x_num(x) / x_den(x), y * y_num(x) / y_den(x)) on a
+                     *  point in Jacobian coordinates, with no inversion.
+                     *
+                     *  The coefficients are given in increasing degree order, those of x_den and y_den without
+                     *  their leading coefficient 1. With x = X / Z^2 every polynomial is evaluated homogeneously in
+                     *  (X, Z^2), and the image (a / b, c / d) is returned as (a * b * d^2 : c * b^3 * d^2 : b * d).
+                     *  If a denominator vanishes the result is the point at infinity, Z = 0, as in RFC 9380 6.6.3.
+                     */
+                    template<typename GroupValueType>
+                    struct jacobian_isogeny_evaluation {
+                        typedef GroupValueType group_value_type;
+                        typedef typename group_value_type::field_value_type field_value_type;
+
+                        template<std::size_t XNum, std::size_t XDen, std::size_t YNum, std::size_t YDen>
+                        static inline group_value_type process(const group_value_type &p,
+                                                               const std::array<field_value_type, XNum> &x_num,
+                                                               const std::array<field_value_type, XDen> &x_den,
+                                                               const std::array<field_value_type, YNum> &y_num,
+                                                               const std::array<field_value_type, YDen> &y_den) {
+                            constexpr static const std::size_t x_degree = std::max(XNum - 1, XDen);
+                            constexpr static const std::size_t y_degree = std::max(YNum - 1, YDen);
+
+                            std::array<field_value_type, std::max(x_degree, y_degree) + 1> z2_powers;
+                            z2_powers[0] = field_value_type::one();
+                            z2_powers[1] = p.Z.squared();
+                            for (std::size_t i = 2; i < z2_powers.size(); ++i) {
+                                z2_powers[i] = z2_powers[i - 1] * z2_powers[1];
+                            }
+
+                            const field_value_type a = evaluate<false>(x_num, p.X, z2_powers, x_degree);
+                            const field_value_type b = evaluate<true>(x_den, p.X, z2_powers, x_degree);
+                            const field_value_type c = p.Y * evaluate<false>(y_num, p.X, z2_powers, y_degree);
+                            // y = Y / Z^3
+                            const field_value_type d =
+                                evaluate<true>(y_den, p.X, z2_powers, y_degree) * z2_powers[1] * p.Z;
+
+                            const field_value_type Z = b * d;
+                            const field_value_type bd2 = Z * d;
+                            return group_value_type(a * bd2, c * b.squared() * bd2, Z);
+                        }
+
+                        template<typename IntegralType, std::size_t N>
+                        static inline std::array<field_value_type, N>
+                            to_field_values(const std::array<IntegralType, N> &coefficients) {
+                            std::array<field_value_type, N> result;
+                            for (std::size_t i = 0; i < N; ++i) {
+                                result[i] = field_value_type(coefficients[i]);
+                            }
+                            return result;
+                        }
+
+                        template<typename IntegralType, std::size_t N>
+                        static inline std::array<field_value_type, N>
+                            to_field_values(const std::array<std::array<IntegralType, 2>, N> &coefficients) {
+                            std::array<field_value_type, N> result;
+                            for (std::size_t i = 0; i < N; ++i) {
+                                result[i] = field_value_type(coefficients[i][0], coefficients[i][1]);
+                            }
+                            return result;
+                        }
+
+                    private:
+                        /// sum of k[i] * X^i * Z^(2 * (degree - i)), plus X^N * Z^(2 * (degree - N)) if Monic,
+                        /// by Horner's rule in X
+                        template<bool Monic, std::size_t N, std::size_t M>
+                        static inline field_value_type evaluate(const std::array<field_value_type, N> &k,
+                                                                const field_value_type &X,
+                                                                const std::array<field_value_type, M> &z2_powers,
+                                                                std::size_t degree) {
+                            std::size_t i = Monic ? N : N - 1;
+                            field_value_type result = Monic ? z2_powers[degree - N] : k[N - 1] * z2_powers[degree - i];
+                            while (i-- > 0) {
+                                result = result * X + k[i] * z2_powers[degree - i];
+                            }
+                            return result;
+                        }
+                    };
+
                     template<typename GroupType>
                     class iso_map;
 
@@ -115,42 +198,14 @@ namespace nil {
 
                     public:
                         static inline group_value_type process(const group_value_type &ci) {
-                            field_value_type x_num = field_value_type::zero();
-                            field_value_type x_den = field_value_type::zero();
-                            field_value_type y_num = field_value_type::zero();
-                            field_value_type y_den = field_value_type::zero();
-
-                            std::vector<field_value_type> xi_powers = [&ci]() {
-                                std::vector<field_value_type> xi_powers {field_value_type::one()};
-                                for (std::size_t i = 0; i < 15; i++) {
-                                    xi_powers.emplace_back(xi_powers.back() * ci.X);
-                                }
-                                return xi_powers;
-                            }();
-
-                            for (std::size_t i = 0; i < k_x_den.size(); i++) {
-                                x_den += field_value_type(k_x_den[i]) * xi_powers[i];
-                            }
-                            x_den += xi_powers[k_x_den.size()];
-
-                            for (std::size_t i = 0; i < k_y_den.size(); i++) {
-                                y_den += field_value_type(k_y_den[i]) * xi_powers[i];
-                            }
-                            y_den += xi_powers[k_y_den.size()];
+                            typedef jacobian_isogeny_evaluation<group_value_type> evaluation_type;
 
-                            if (x_den.is_zero() || y_den.is_zero()) {
-                                return group_value_type::one();
-                            }
+                            static const auto x_num = evaluation_type::to_field_values(k_x_num);
+                            static const auto x_den = evaluation_type::to_field_values(k_x_den);
+                            static const auto y_num = evaluation_type::to_field_values(k_y_num);
+                            static const auto y_den = evaluation_type::to_field_values(k_y_den);
 
-                            for (std::size_t i = 0; i < k_x_num.size(); i++) {
-                                x_num += field_value_type(k_x_num[i]) * xi_powers[i];
-                            }
-
-                            for (std::size_t i = 0; i < k_y_num.size(); i++) {
-                                y_num += field_value_type(k_y_num[i]) * xi_powers[i];
-                            }
-
-                            return group_value_type(x_num * x_den.inversed(), ci.Y * y_num * y_den.inversed(), field_value_type::one());
+                            return evaluation_type::process(ci, x_num, x_den, y_num, y_den);
                         }
                     };
 
@@ -202,42 +257,150 @@ namespace nil {
 
                     public:
                         static inline group_value_type process(const group_value_type &ci) {
-                            field_value_type x_num = field_value_type::zero();
-                            field_value_type x_den = field_value_type::zero();
-                            field_value_type y_num = field_value_type::zero();
-                            field_value_type y_den = field_value_type::zero();
-
-                            std::vector<field_value_type> xi_powers = [&ci]() {
-                                std::vector<field_value_type> xi_powers {field_value_type::one()};
-                                for (std::size_t i = 0; i < 3; i++) {
-                                    xi_powers.emplace_back(xi_powers.back() * ci.X);
-                                }
-                                return xi_powers;
-                            }();
-
-                            for (std::size_t i = 0; i < k_x_den.size(); i++) {
-                                x_den += field_value_type(k_x_den[i][0], k_x_den[i][1]) * xi_powers[i];
-                            }
-                            x_den += xi_powers[k_x_den.size()];
+                            typedef jacobian_isogeny_evaluation<group_value_type> evaluation_type;
 
-                            for (std::size_t i = 0; i < k_y_den.size(); i++) {
-                                y_den += field_value_type(k_y_den[i][0], k_y_den[i][1]) * xi_powers[i];
-                            }
-                            y_den += xi_powers[k_y_den.size()];
+                            static const auto x_num = evaluation_type::to_field_values(k_x_num);
+                            static const auto x_den = evaluation_type::to_field_values(k_x_den);
+                            static const auto y_num = evaluation_type::to_field_values(k_y_num);
+                            static const auto y_den = evaluation_type::to_field_values(k_y_den);
 
-                            if (x_den.is_zero() || y_den.is_zero()) {
-                                return group_value_type::one();
-                            }
+                            return evaluation_type::process(ci, x_num, x_den, y_num, y_den);
+                        }
+                    };
 
-                            for (std::size_t i = 0; i < k_x_num.size(); i++) {
-                                x_num += field_value_type(k_x_num[i][0], k_x_num[i][1]) * xi_powers[i];
-                            }
+                    // 3-isogeny map for secp256k1
+                    // https://www.rfc-editor.org/rfc/rfc9380#appendix-E.1
+                    template<>
+                    class iso_map<typename secp256k1::g1_type<>> {
+                        typedef typename secp256k1::g1_type<> group_type;
+                        typedef h2c_suite<group_type> suite_type;
 
-                            for (std::size_t i = 0; i < k_y_num.size(); i++) {
-                                y_num += field_value_type(k_y_num[i][0], k_y_num[i][1]) * xi_powers[i];
-                            }
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+                        typedef typename suite_type::integral_type integral_type;
+
+                        // TODO: change integral_type on field_value_type when constexpr will be finished
+                        constexpr static std::array<integral_type, 4> k_x_num = {
+                            0x8e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38daaaaa8c7_cppui_modular256,
+                            0x7d3d4c80bc321d5b9f315cea7fd44c5d595d2fc0bf63b92dfff1044f17c6581_cppui_modular251,
+                            0x534c328d23f234e6e2a413deca25caece4506144037c40314ecbd0b53d9dd262_cppui_modular255,
+                            0x8e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38e38daaaaa88c_cppui_modular256};
+
+                        constexpr static std::array<integral_type, 2> k_x_den = {
+                            0xd35771193d94918a9ca34ccbb7b640dd86cd409542f8487d9fe6b745781eb49b_cppui_modular256,
+                            0xedadc6f64383dc1df7c4b2d51b54225406d36b641f5e41bbc52a56612a8c6d14_cppui_modular256};
+
+                        constexpr static std::array<integral_type, 4> k_y_num = {
+                            0x4bda12f684bda12f684bda12f684bda12f684bda12f684bda12f684b8e38e23c_cppui_modular255,
+                            0xc75e0c32d5cb7c0fa9d0a54b12a0a6d5647ab046d686da6fdffc90fc201d71a3_cppui_modular256,
+                            0x29a6194691f91a73715209ef6512e576722830a201be2018a765e85a9ecee931_cppui_modular254,
+                            0x2f684bda12f684bda12f684bda12f684bda12f684bda12f684bda12f38e38d84_cppui_modular254};
+
+                        constexpr static std::array<integral_type, 3> k_y_den = {
+                            0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffff93b_cppui_modular256,
+                            0x7a06534bb8bdb49fd5e9e6632722c2989467c1bfc8e8d978dfb425d2685c2573_cppui_modular255,
+                            0x6484aa716545ca2cf3a70c3fa8fe337e0a3d21162f0d6299a7bf8192bfd2a76f_cppui_modular255};
+
+                    public:
+                        static inline group_value_type process(const group_value_type &ci) {
+                            typedef jacobian_isogeny_evaluation<group_value_type> evaluation_type;
+
+                            static const auto x_num = evaluation_type::to_field_values(k_x_num);
+                            static const auto x_den = evaluation_type::to_field_values(k_x_den);
+                            static const auto y_num = evaluation_type::to_field_values(k_y_num);
+                            static const auto y_den = evaluation_type::to_field_values(k_y_den);
+
+                            return evaluation_type::process(ci, x_num, x_den, y_num, y_den);
+                        }
+                    };
+
+                    // 3-isogeny map from iso-Pallas to Pallas, as in the Zcash pasta curves
+                    template<>
+                    class iso_map<typename pallas::g1_type<>> {
+                        typedef typename pallas::g1_type<> group_type;
+                        typedef h2c_suite<group_type> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+                        typedef typename suite_type::integral_type integral_type;
+
+                        // TODO: change integral_type on field_value_type when constexpr will be finished
+                        constexpr static std::array<integral_type, 4> k_x_num = {
+                            0x1c71c71c71c71c71c71c71c71c71c71c8102eea8e7b06eb6eebec06955555580_cppui_modular253,
+                            0x17329b9ec525375398c7d7ac3d98fd13380af066cfeb6d690eb64faef37ea4f7_cppui_modular253,
+                            0x3509afd51872d88e267c7ffa51cf412a0f93b82ee4b994958cf863b02814fb76_cppui_modular254,
+                            0xe38e38e38e38e38e38e38e38e38e38e4081775473d8375b775f6034aaaaaaab_cppui_modular252};
+
+                        constexpr static std::array<integral_type, 2> k_x_den = {
+                            0x325669becaecd5d11d13bf2a7f22b105b4abf9fb9a1fc81c2aa3af1eae5b6604_cppui_modular254,
+                            0x1d572e7ddc099cff5a607fcce0494a799c434ac1c96b6980c47f2ab668bcd71f_cppui_modular253};
+
+                        constexpr static std::array<integral_type, 4> k_y_num = {
+                            0x25ed097b425ed097b425ed097b425ed0ac03e8e134eb3e493e53ab371c71c4f_cppui_modular250,
+                            0x3fb98ff0d2ddcadd303216cce1db9ff11765e924f745937802e2be87d225b234_cppui_modular254,
+                            0x1a84d7ea8c396c47133e3ffd28e7a09507c9dc17725cca4ac67c31d8140a7dbb_cppui_modular253,
+                            0x1a12f684bda12f684bda12f684bda12f7642b01ad461bad25ad985b5e38e38e4_cppui_modular253};
+
+                        constexpr static std::array<integral_type, 3> k_y_den = {
+                            0x40000000000000000000000000000000224698fc094cf91b992d30ecfffffde5_cppui_modular255,
+                            0x17033d3c60c68173573b3d7f7d681310d976bbfabbc5661d4d90ab820b12320a_cppui_modular253,
+                            0xc02c5bcca0e6b7f0790bfb3506defb65941a3a4a97aa1b35a28279b1d1b42ae_cppui_modular252};
+
+                    public:
+                        static inline group_value_type process(const group_value_type &ci) {
+                            typedef jacobian_isogeny_evaluation<group_value_type> evaluation_type;
+
+                            static const auto x_num = evaluation_type::to_field_values(k_x_num);
+                            static const auto x_den = evaluation_type::to_field_values(k_x_den);
+                            static const auto y_num = evaluation_type::to_field_values(k_y_num);
+                            static const auto y_den = evaluation_type::to_field_values(k_y_den);
+
+                            return evaluation_type::process(ci, x_num, x_den, y_num, y_den);
+                        }
+                    };
+
+                    // 3-isogeny map from iso-Vesta to Vesta, as in the Zcash pasta curves
+                    template<>
+                    class iso_map<typename vesta::g1_type<>> {
+                        typedef typename vesta::g1_type<> group_type;
+                        typedef h2c_suite<group_type> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+                        typedef typename suite_type::integral_type integral_type;
+
+                        // TODO: change integral_type on field_value_type when constexpr will be finished
+                        constexpr static std::array<integral_type, 4> k_x_num = {
+                            0x31c71c71c71c71c71c71c71c71c71c71e1c521a795ac8356fb539a6f0000002b_cppui_modular254,
+                            0x18760c7f7a9ad20ded7ee4a9cdf78f8fd59d03d23b39cb11aeac67bbeb586a3d_cppui_modular253,
+                            0x1d935247b4473d17acecf10f5f7c09a2216b8861ec72bd5d8b95c6aaf703bcc5_cppui_modular253,
+                            0x38e38e38e38e38e38e38e38e38e38e390205dd51cfa0961a43cd42c800000001_cppui_modular254};
+
+                        constexpr static std::array<integral_type, 2> k_x_den = {
+                            0x14735171ee5427780c621de8b91c242a30cd6d53df49d235f169c187d2533465_cppui_modular253,
+                            0xa2de485568125d51454798a5b5c56b2a3ad678129b604d3b7284f7eaf21a2e9_cppui_modular252};
+
+                        constexpr static std::array<integral_type, 4> k_y_num = {
+                            0x1ed097b425ed097b425ed097b425ed098bc32d36fb21a6a38f64842c55555533_cppui_modular253,
+                            0x19b0d87e16e2578866d1466e9de10e6497a3ca5c24e9ea634986913ab4443034_cppui_modular253,
+                            0x2ec9a923da239e8bd6767887afbe04d121d910aefb03b31d8bee58e5fb81de63_cppui_modular254,
+                            0x12f684bda12f684bda12f684bda12f685601f4709a8adcb36bef1642aaaaaaab_cppui_modular253};
+
+                        constexpr static std::array<integral_type, 3> k_y_den = {
+                            0x40000000000000000000000000000000224698fc0994a8dd8c46eb20fffffde5_cppui_modular255,
+                            0x3d59f455cafc7668252659ba2b546c7e926847fb9ddd76a1d43d449776f99d2f_cppui_modular254,
+                            0x2f44d6c801c1b8bf9e7eb64f890a820c06a767bfc35b5bac58dfecce86b2745e_cppui_modular254};
+
+                    public:
+                        static inline group_value_type process(const group_value_type &ci) {
+                            typedef jacobian_isogeny_evaluation<group_value_type> evaluation_type;
+
+                            static const auto x_num = evaluation_type::to_field_values(k_x_num);
+                            static const auto x_den = evaluation_type::to_field_values(k_x_den);
+                            static const auto y_num = evaluation_type::to_field_values(k_y_num);
+                            static const auto y_den = evaluation_type::to_field_values(k_y_den);
 
-                            return group_value_type(x_num * x_den.inversed(), ci.Y * y_num * y_den.inversed(), field_value_type::one());
+                            return evaluation_type::process(ci, x_num, x_den, y_num, y_den);
                         }
                     };
                 }    // namespace detail
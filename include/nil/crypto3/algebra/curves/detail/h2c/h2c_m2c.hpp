@@ -31,12 +31,71 @@
 #include <nil/crypto3/algebra/curves/detail/h2c/h2c_sgn0.hpp>
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+
+#include <cstddef>
+#include <type_traits>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace curves {
                 namespace detail {
+                    /** @brief sqrt_ratio of RFC 9380 F.2.1.1: whether u / v is square, with y = sqrt(u / v) if it
+                     *  is and y = sqrt(Z * u / v) otherwise. One exponentiation, no inversion, v must not be zero.
+                     */
+                    template<typename GroupType>
+                    struct sqrt_ratio {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        static inline bool process(const field_value_type &u, const field_value_type &v,
+                                                   field_value_type &y) {
+                            constexpr static const std::size_t c1 = suite_type::sqrt_ratio_c1;
+                            constexpr static const std::size_t c4 = (std::size_t(1) << c1) - 1;
+                            constexpr static const std::size_t c5 = std::size_t(1) << (c1 - 1);
+
+                            field_value_type tv1 = suite_type::sqrt_ratio_c6;
+                            field_value_type tv2 = v.pow(c4);
+                            field_value_type tv3 = tv2.squared() * v;
+                            field_value_type tv5 = (u * tv3).pow(suite_type::sqrt_ratio_c3) * tv2;
+                            tv2 = tv5 * v;
+                            tv3 = tv5 * u;
+                            field_value_type tv4 = tv3 * tv2;
+
+                            const bool is_qr = tv4.pow(c5).is_one();
+                            if (!is_qr) {
+                                tv3 = tv3 * suite_type::sqrt_ratio_c7;
+                                tv4 = tv4 * tv1;
+                            }
+
+                            for (std::size_t i = c1; i >= 2; --i) {
+                                const bool e1 = tv4.pow(std::size_t(1) << (i - 2)).is_one();
+                                tv2 = tv3 * tv1;
+                                tv1 = tv1.squared();
+                                tv5 = tv4 * tv1;
+                                if (!e1) {
+                                    tv3 = tv2;
+                                    tv4 = tv5;
+                                }
+                            }
+
+                            y = tv3;
+                            return is_qr;
+                        }
+                    };
+
+                    /** @brief Simplified SWU map of RFC 9380 6.6.2 in the straight-line form of F.2, to the curve
+                     *  y^2 = x^3 + Ai * x + Bi of the suite. The point is returned in Jacobian coordinates with
+                     *  Z = the denominator of x, so that no inversion is done.
+                     *
+                     *  Z of the suite must be a non-square, differ from -1, make g(x) - Z irreducible and
+                     *  g(B / (Z * A)) square, which holds for the RFC 9380 suites.
+                     */
                     template<typename GroupType>
                     struct m2c_simple_swu {
                         typedef h2c_suite<GroupType> suite_type;
@@ -44,38 +103,34 @@ namespace nil {
                         typedef typename suite_type::group_value_type group_value_type;
                         typedef typename suite_type::field_value_type field_value_type;
 
+                        static_assert(std::is_same<typename group_value_type::coordinates,
+                                                   coordinates::jacobian_with_a4_0>::value,
+                                      "the map returns Jacobian coordinates");
+
                         static inline group_value_type process(const field_value_type &u) {
-                            // TODO: We assume that Z meets the following criteria -- correct for predefined suites,
-                            //  but wrong in general case
-                            // https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-10#section-6.6.2
-                            // Preconditions:
-                            // 1.  Z is non-square in F,
-                            // 2.  Z != -1 in F,
-                            // 3.  the polynomial g(x) - Z is irreducible over F, and
-                            // 4.  g(B / (Z * A)) is square in F.
-                            static const field_value_type one = field_value_type::one();
-
-                            field_value_type tv1 =
-                                (suite_type::Z.pow(2) * u.pow(4) + suite_type::Z * u.pow(2)).inversed();
-                            field_value_type x1 = (-suite_type::Bi * suite_type::Ai.inversed()) * (one + tv1);
-                            if (tv1.is_zero()) {
-                                x1 = suite_type::Bi * (suite_type::Z * suite_type::Ai).inversed();
-                            }
-                            field_value_type gx1 = x1.pow(3) + suite_type::Ai * x1 + suite_type::Bi;
-                            field_value_type x2 = suite_type::Z * u.pow(2) * x1;
-                            field_value_type gx2 = x2.pow(3) + suite_type::Ai * x2 + suite_type::Bi;
-                            field_value_type x, y;
-                            if (gx1.is_square()) {
-                                x = x1;
-                                y = gx1.sqrt();
-                            } else {
-                                x = x2;
-                                y = gx2.sqrt();
-                            }
+                            const field_value_type tv1 = suite_type::Z * u.squared();
+                            field_value_type tv2 = tv1.squared() + tv1;
+                            const field_value_type tv3 = suite_type::Bi * (tv2 + field_value_type::one());
+                            // x = tv3 / tv4 or tv1 * tv3 / tv4, tv4 = A * (-tv2), or A * Z in the exceptional case
+                            const field_value_type tv4 = suite_type::Ai * (tv2.is_zero() ? suite_type::Z : -tv2);
+
+                            field_value_type tv6 = tv4.squared();
+                            // gx1 = g(tv3 / tv4) * tv4^3 = tv2 / tv6
+                            tv2 = (tv3.squared() + suite_type::Ai * tv6) * tv3;
+                            tv6 = tv6 * tv4;
+                            tv2 = tv2 + suite_type::Bi * tv6;
+
+                            field_value_type y1;
+                            const bool is_gx1_square = sqrt_ratio<GroupType>::process(tv2, tv6, y1);
+
+                            field_value_type x = is_gx1_square ? tv3 : tv1 * tv3;
+                            field_value_type y = is_gx1_square ? y1 : tv1 * u * y1;
                             if (sgn0(u) != sgn0(y)) {
                                 y = -y;
                             }
-                            return group_value_type(x, y, one);
+
+                            // (x / tv4, y) is (x * tv4 : y * tv4^3 : tv4) in Jacobian coordinates
+                            return group_value_type(x * tv4, y * tv6, tv4);
                         }
                     };
 
@@ -92,6 +147,83 @@ namespace nil {
                         }
                     };
 
+                    /** @brief Shallue-van de Woestijne map of RFC 9380 6.6.1 to the curve y^2 = x^3 + A * x + B of
+                     *  GroupType, for curves where neither simplified SWU nor an isogeny applies. The candidates
+                     *  x1, x2, x3 are kept as fractions n / d: g(n / d) is square iff (n^3 + A * n * d^2 + B * d^3) * d
+                     *  is, and y comes from sqrt_ratio, so the point is returned in Jacobian coordinates
+                     *  (n * d : y * d^3 : d) and no inversion is done.
+                     *
+                     *  As in the straight-line form of F.1, all candidates are computed, the one to use is selected
+                     *  from the is_square flags and a single square root is taken.
+                     */
+                    template<typename GroupType>
+                    struct m2c_svdw {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::group_value_type group_value_type;
+                        typedef typename suite_type::field_value_type field_value_type;
+
+                        static_assert(std::is_same<typename group_value_type::coordinates,
+                                                   coordinates::jacobian_with_a4_0>::value,
+                                      "the map returns Jacobian coordinates");
+
+                        static inline group_value_type process(const field_value_type &u) {
+                            const field_value_type tv1 = u.squared() * suite_type::svdw_c1;
+                            const field_value_type tv2 = field_value_type::one() + tv1;
+                            const field_value_type tv3 = field_value_type::one() - tv1;
+
+                            // x1, x2 = c2 -+ c3 * u / tv2 and x3 = c4 * (tv2 / tv3)^2 + Z, with inv0(tv2 * tv3) = 0
+                            // giving x1 = x2 = c2 and x3 = Z
+                            const bool is_exceptional = (tv2 * tv3).is_zero();
+                            const field_value_type c2_tv2 = suite_type::svdw_c2 * tv2;
+                            const field_value_type c3_u = suite_type::svdw_c3 * u;
+                            const field_value_type tv3_squared = tv3.squared();
+
+                            const field_value_type n1 = is_exceptional ? suite_type::svdw_c2 : c2_tv2 - c3_u;
+                            const field_value_type n2 = is_exceptional ? suite_type::svdw_c2 : c2_tv2 + c3_u;
+                            const field_value_type d = is_exceptional ? field_value_type::one() : tv2;
+                            const field_value_type d3 = is_exceptional ? field_value_type::one() : tv3_squared;
+                            const field_value_type n3 =
+                                is_exceptional ? suite_type::Z :
+                                                 suite_type::svdw_c4 * tv2.squared() + suite_type::Z * tv3_squared;
+
+                            const field_value_type d_squared = d.squared();
+                            const field_value_type d_cubed = d_squared * d;
+                            const field_value_type d3_squared = d3.squared();
+                            const field_value_type d3_cubed = d3_squared * d3;
+
+                            // straight-line selection of F.1: all three candidates are evaluated and the first
+                            // square one is picked, so that the running time does not depend on u
+                            const field_value_type gx1 = g_numerator(n1, d_squared, d_cubed);
+                            const field_value_type gx2 = g_numerator(n2, d_squared, d_cubed);
+                            const field_value_type gx3 = g_numerator(n3, d3_squared, d3_cubed);
+                            const bool e1 = (gx1 * d).is_square();
+                            const bool e2 = (gx2 * d).is_square() && !e1;
+
+                            const field_value_type n = e1 ? n1 : (e2 ? n2 : n3);
+                            const field_value_type den = (e1 || e2) ? d : d3;
+                            const field_value_type den_cubed = (e1 || e2) ? d_cubed : d3_cubed;
+                            const field_value_type gx = e1 ? gx1 : (e2 ? gx2 : gx3);
+
+                            // g(x3) is square by the choice of Z, so sqrt_ratio always finds the root here
+                            field_value_type y;
+                            sqrt_ratio<GroupType>::process(gx, den_cubed, y);
+                            if (sgn0(u) != sgn0(y)) {
+                                y = -y;
+                            }
+
+                            return group_value_type(n * den, y * den_cubed, den);
+                        }
+
+                    private:
+                        /// g(n / d) * d^3, given d^2 and d^3
+                        static inline field_value_type g_numerator(const field_value_type &n,
+                                                                   const field_value_type &d_squared,
+                                                                   const field_value_type &d_cubed) {
+                            return (n.squared() + suite_type::A * d_squared) * n + suite_type::B * d_cubed;
+                        }
+                    };
+
                     template<typename GroupType>
                     struct map_to_curve;
 
@@ -102,6 +234,22 @@ namespace nil {
                     template<>
                     struct map_to_curve<typename bls12_381::g2_type<>>
                         : m2c_simple_swu_zeroAB<typename bls12_381::g2_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename secp256k1::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename secp256k1::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename pallas::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename pallas::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename vesta::g1_type<>>
+                        : m2c_simple_swu_zeroAB<typename vesta::g1_type<>> { };
+
+                    template<>
+                    struct map_to_curve<typename alt_bn128_254::g1_type<>>
+                        : m2c_svdw<typename alt_bn128_254::g1_type<>> { };
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
@@ -0,0 +1,68 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SGN0_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SGN0_HPP
+
+#include <boost/multiprecision/number.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /// sgn0 of RFC 9380 4.1 for a prime field element: its parity
+                    template<typename FieldValueType>
+                    inline typename std::enable_if<FieldValueType::field_type::arity == 1, bool>::type
+                        sgn0(const FieldValueType &e) {
+                        typedef typename FieldValueType::integral_type integral_type;
+
+                        return boost::multiprecision::bit_test(e.data.template convert_to<integral_type>(), 0);
+                    }
+
+                    /// sgn0 of RFC 9380 4.1 for an extension field element: the parity of its lowest
+                    /// non-zero component. All components are visited whatever their value.
+                    template<typename FieldValueType>
+                    inline typename std::enable_if<(FieldValueType::field_type::arity > 1), bool>::type
+                        sgn0(const FieldValueType &e) {
+                        bool sign = false;
+                        bool zero = true;
+                        for (std::size_t i = 0; i < e.data.size(); ++i) {
+                            const bool sign_i = sgn0(e.data[i]);
+                            sign = sign | (zero & sign_i);
+                            zero = zero & e.data[i].is_zero();
+                        }
+                        return sign;
+                    }
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SGN0_HPP
@@ -0,0 +1,522 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SUITES_HPP
+#define CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SUITES_HPP
+
+#include <nil/crypto3/algebra/curves/detail/h2c/h2c_expand.hpp>
+
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/vesta.hpp>
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace curves {
+                namespace detail {
+                    /** @brief Parameters of the RFC 9380 hash-to-curve suite of GroupType.
+                     *
+                     *  For the simplified SWU suites Ai, Bi are the coefficients of the curve
+                     *  E': y^2 = x^3 + Ai * x + Bi the map lands on, isogenous to the curve of GroupType, and Z is
+                     *  the non-square of the map. The Shallue-van de Woestijne suites give the coefficients A, B
+                     *  of the curve of GroupType itself, Z and the svdw_c constants.
+                     */
+                    template<typename GroupType>
+                    struct h2c_suite;
+
+                    /// BLS12381G1_XMD:SHA-256_SSWU_RO_ and _NU_, RFC 9380 8.8.1
+                    template<>
+                    struct h2c_suite<typename bls12_381::g1_type<>> {
+                        typedef typename bls12_381::g1_type<> group_type;
+                        typedef typename group_type::value_type group_value_type;
+
+                        typedef typename group_type::field_type field_type;
+                        typedef typename field_type::value_type field_value_type;
+                        typedef typename bls12_381::base_field_type base_field_type;
+                        typedef typename base_field_type::integral_type integral_type;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<64>>
+                            cofactor_integral_type;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<379>>
+                            sqrt_ratio_integral_type;
+
+                        typedef expand_message_xmd<sha2_256> expand_message_type;
+
+                        constexpr static const std::size_t m = 1;      ///< extension degree of field_type
+                        constexpr static const std::size_t k = 128;    ///< security level in bits
+                        constexpr static const std::size_t L = 64;     ///< ceil((ceil(log2(p)) + k) / 8)
+
+                        constexpr static const field_value_type Ai = field_value_type(
+                            0x144698A3B8E9433D693A02C96D4982B0EA985383EE66A8D8E8981AEFD881AC98936F8DA0E0F97F5CF428082D584C1D_cppui_modular373);
+                        constexpr static const field_value_type Bi = field_value_type(
+                            0x12E2908D11688030018B12E8753EEE3B2016C1F0F24F4070A0B9C14FCEF35EF55A23215A316CEAA5D1CC48E98E172BE0_cppui_modular381);
+                        constexpr static const field_value_type Z = field_value_type(11);
+
+                        /// sqrt_ratio constants of RFC 9380 F.2.1.1, c1 = v_2(q - 1), c2 = (q - 1) / 2^c1,
+                        /// c3 = (c2 - 1) / 2, c6 = Z^c2, c7 = Z^((c2 + 1) / 2)
+                        constexpr static const std::size_t sqrt_ratio_c1 = 1;
+                        constexpr static const sqrt_ratio_integral_type sqrt_ratio_c3 =
+                            0x680447A8E5FF9A692C6E9ED90D2EB35D91DD2E13CE144AFD9CC34A83DAC3D8907AAFFFFAC54FFFFEE7FBFFFFFFFEAAA_cppui_modular379;
+                        constexpr static const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0x1A0111EA397FE69A4B1BA7B6434BACD764774B84F38512BF6730D2A0F6B0F6241EABFFFEB153FFFFB9FEFFFFFFFFAAAA_cppui_modular381);
+                        constexpr static const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x15A003E9FDAC3A056B72834A0A3E325ED0514982620F6DF530C37281C2BD61B5DFD8686A3DF7C7CE5C77B43E28F972E8_cppui_modular381);
+
+                        constexpr static const cofactor_integral_type h_eff = 0xD201000000010001_cppui_modular64;
+                    };
+
+                    /// BLS12381G2_XMD:SHA-256_SSWU_RO_ and _NU_, RFC 9380 8.8.2
+                    template<>
+                    struct h2c_suite<typename bls12_381::g2_type<>> {
+                        typedef typename bls12_381::g2_type<> group_type;
+                        typedef typename group_type::value_type group_value_type;
+
+                        typedef typename group_type::field_type field_type;
+                        typedef typename field_type::value_type field_value_type;
+                        typedef typename bls12_381::base_field_type base_field_type;
+                        typedef typename base_field_type::integral_type integral_type;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<636>>
+                            cofactor_integral_type;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<758>>
+                            sqrt_ratio_integral_type;
+
+                        typedef expand_message_xmd<sha2_256> expand_message_type;
+
+                        constexpr static const std::size_t m = 2;      ///< extension degree of field_type
+                        constexpr static const std::size_t k = 128;    ///< security level in bits
+                        constexpr static const std::size_t L = 64;     ///< ceil((ceil(log2(p)) + k) / 8)
+
+                        constexpr static const field_value_type Ai = field_value_type(0, 240);
+                        constexpr static const field_value_type Bi = field_value_type(1012, 1012);
+                        /// -(2 + I)
+                        constexpr static const field_value_type Z = field_value_type(
+                            typename field_value_type::underlying_type(
+                                0x1A0111EA397FE69A4B1BA7B6434BACD764774B84F38512BF6730D2A0F6B0F6241EABFFFEB153FFFFB9FEFFFFFFFFAAA9_cppui_modular381),
+                            typename field_value_type::underlying_type(
+                                0x1A0111EA397FE69A4B1BA7B6434BACD764774B84F38512BF6730D2A0F6B0F6241EABFFFEB153FFFFB9FEFFFFFFFFAAAA_cppui_modular381));
+
+                        /// sqrt_ratio constants of RFC 9380 F.2.1.1 for q = p^2
+                        constexpr static const std::size_t sqrt_ratio_c1 = 3;
+                        constexpr static const sqrt_ratio_integral_type sqrt_ratio_c3 =
+                            0x2A437A4B8C35FC74BD278EAA22F25E9E2DC90E50E7046B466E59E49349E8BD050A62CFD16DDCA6EF53149330978EF011D68619C86185C7B292E85A87091A04966BF91ED3E71B743162C338362113CFD7CED6B1D76382EAB26AA00001C718E3_cppui_modular758;
+                        constexpr static const field_value_type sqrt_ratio_c6 = field_value_type(
+                            typename field_value_type::underlying_type(
+                                0x6AF0E0437FF400B6831E36D6BD17FFE48395DABC2D3435E77F76E17009241C5EE67992F72EC05F4C81084FBEDE3CC09_cppui_modular379),
+                            typename field_value_type::underlying_type(
+                                0x6AF0E0437FF400B6831E36D6BD17FFE48395DABC2D3435E77F76E17009241C5EE67992F72EC05F4C81084FBEDE3CC09_cppui_modular379));
+                        constexpr static const field_value_type sqrt_ratio_c7 = field_value_type(
+                            typename field_value_type::underlying_type(
+                                0x13DC0969311E2BA565924CB0B6F7BB9857F157E17F0C8DB4E484FCB27B8BE0B36DFA0340C422FB7EFE9D9A3234336D5E_cppui_modular381),
+                            typename field_value_type::underlying_type(
+                                0x71D42AC9C54001A21ACF9187D469D919A830A2C969128D22659DC2F8263F1CA73C5B0E02C05EC381B8684A676A81381_cppui_modular379));
+
+                        constexpr static const cofactor_integral_type h_eff =
+                            0xBC69F08F2EE75B3584C6A0EA91B352888E2A8E9145AD7689986FF031508FFE1329C2F178731DB956D82BF015D1212B02EC0EC69D7477C1AE954CBC06689F6A359894C0ADEBBF6B4E8020005AAA95551_cppui_modular636;
+                    };
+
+                    constexpr std::size_t const h2c_suite<typename bls12_381::g1_type<>>::m;
+                    constexpr std::size_t const h2c_suite<typename bls12_381::g1_type<>>::k;
+                    constexpr std::size_t const h2c_suite<typename bls12_381::g1_type<>>::L;
+                    constexpr typename h2c_suite<typename bls12_381::g1_type<>>::field_value_type const
+                        h2c_suite<typename bls12_381::g1_type<>>::Ai;
+                    constexpr typename h2c_suite<typename bls12_381::g1_type<>>::field_value_type const
+                        h2c_suite<typename bls12_381::g1_type<>>::Bi;
+                    constexpr typename h2c_suite<typename bls12_381::g1_type<>>::field_value_type const
+                        h2c_suite<typename bls12_381::g1_type<>>::Z;
+                    constexpr typename h2c_suite<typename bls12_381::g1_type<>>::cofactor_integral_type const
+                        h2c_suite<typename bls12_381::g1_type<>>::h_eff;
+                    constexpr std::size_t const h2c_suite<typename bls12_381::g1_type<>>::sqrt_ratio_c1;
+                    constexpr typename h2c_suite<typename bls12_381::g1_type<>>::sqrt_ratio_integral_type const
+                        h2c_suite<typename bls12_381::g1_type<>>::sqrt_ratio_c3;
+                    constexpr typename h2c_suite<typename bls12_381::g1_type<>>::field_value_type const
+                        h2c_suite<typename bls12_381::g1_type<>>::sqrt_ratio_c6;
+                    constexpr typename h2c_suite<typename bls12_381::g1_type<>>::field_value_type const
+                        h2c_suite<typename bls12_381::g1_type<>>::sqrt_ratio_c7;
+
+                    constexpr std::size_t const h2c_suite<typename bls12_381::g2_type<>>::m;
+                    constexpr std::size_t const h2c_suite<typename bls12_381::g2_type<>>::k;
+                    constexpr std::size_t const h2c_suite<typename bls12_381::g2_type<>>::L;
+                    constexpr typename h2c_suite<typename bls12_381::g2_type<>>::field_value_type const
+                        h2c_suite<typename bls12_381::g2_type<>>::Ai;
+                    constexpr typename h2c_suite<typename bls12_381::g2_type<>>::field_value_type const
+                        h2c_suite<typename bls12_381::g2_type<>>::Bi;
+                    constexpr typename h2c_suite<typename bls12_381::g2_type<>>::field_value_type const
+                        h2c_suite<typename bls12_381::g2_type<>>::Z;
+                    constexpr typename h2c_suite<typename bls12_381::g2_type<>>::cofactor_integral_type const
+                        h2c_suite<typename bls12_381::g2_type<>>::h_eff;
+                    constexpr std::size_t const h2c_suite<typename bls12_381::g2_type<>>::sqrt_ratio_c1;
+                    constexpr typename h2c_suite<typename bls12_381::g2_type<>>::sqrt_ratio_integral_type const
+                        h2c_suite<typename bls12_381::g2_type<>>::sqrt_ratio_c3;
+                    constexpr typename h2c_suite<typename bls12_381::g2_type<>>::field_value_type const
+                        h2c_suite<typename bls12_381::g2_type<>>::sqrt_ratio_c6;
+                    constexpr typename h2c_suite<typename bls12_381::g2_type<>>::field_value_type const
+                        h2c_suite<typename bls12_381::g2_type<>>::sqrt_ratio_c7;
+
+                    /// secp256k1_XMD:SHA-256_SSWU_RO_ and _NU_, RFC 9380 8.7
+                    template<>
+                    struct h2c_suite<typename secp256k1::g1_type<>> {
+                        typedef typename secp256k1::g1_type<> group_type;
+                        typedef typename group_type::value_type group_value_type;
+
+                        typedef typename group_type::field_type field_type;
+                        typedef typename field_type::value_type field_value_type;
+                        typedef typename secp256k1::base_field_type base_field_type;
+                        typedef typename base_field_type::integral_type integral_type;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<64>>
+                            cofactor_integral_type;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<254>>
+                            sqrt_ratio_integral_type;
+
+                        typedef expand_message_xmd<sha2_256> expand_message_type;
+
+                        constexpr static const std::size_t m = 1;      ///< extension degree of field_type
+                        constexpr static const std::size_t k = 128;    ///< security level in bits
+                        constexpr static const std::size_t L = 48;     ///< ceil((ceil(log2(p)) + k) / 8)
+
+                        constexpr static const field_value_type Ai = field_value_type(
+                            0x3F8731ABDD661ADCA08A5558F0F5D272E953D363CB6F0E5D405447C01A444533_cppui_modular254);
+                        constexpr static const field_value_type Bi = field_value_type(1771);
+                        /// -11
+                        constexpr static const field_value_type Z = field_value_type(
+                            0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC24_cppui_modular256);
+
+                        /// sqrt_ratio constants of RFC 9380 F.2.1.1
+                        constexpr static const std::size_t sqrt_ratio_c1 = 1;
+                        constexpr static const sqrt_ratio_integral_type sqrt_ratio_c3 =
+                            0x3FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFBFFFFF0B_cppui_modular254;
+                        constexpr static const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2E_cppui_modular256);
+                        constexpr static const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x31FDF302724013E57AD13FB38F842AFEEC184F00A74789DD286729C8303C4A59_cppui_modular254);
+
+                        constexpr static const cofactor_integral_type h_eff = 1;
+                    };
+
+                    /// pallas_XMD:SHA-256_SSWU_RO_ and _NU_: the isogeny and Z of the Zcash pasta curves, with the
+                    /// expand_message_xmd of RFC 9380 over SHA-256
+                    template<>
+                    struct h2c_suite<typename pallas::g1_type<>> {
+                        typedef typename pallas::g1_type<> group_type;
+                        typedef typename group_type::value_type group_value_type;
+
+                        typedef typename group_type::field_type field_type;
+                        typedef typename field_type::value_type field_value_type;
+                        typedef typename pallas::base_field_type base_field_type;
+                        typedef typename base_field_type::integral_type integral_type;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<64>>
+                            cofactor_integral_type;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<222>>
+                            sqrt_ratio_integral_type;
+
+                        typedef expand_message_xmd<sha2_256> expand_message_type;
+
+                        constexpr static const std::size_t m = 1;      ///< extension degree of field_type
+                        constexpr static const std::size_t k = 128;    ///< security level in bits
+                        constexpr static const std::size_t L = 48;     ///< ceil((ceil(log2(p)) + k) / 8)
+
+                        constexpr static const field_value_type Ai = field_value_type(
+                            0x18354A2EB0EA8C9C49BE2D7258370742B74134581A27A59F92BB4B0B657A014B_cppui_modular253);
+                        constexpr static const field_value_type Bi = field_value_type(1265);
+                        /// -13
+                        constexpr static const field_value_type Z = field_value_type(
+                            0x40000000000000000000000000000000224698FC094CF91B992D30ECFFFFFFF4_cppui_modular255);
+
+                        /// sqrt_ratio constants of RFC 9380 F.2.1.1
+                        constexpr static const std::size_t sqrt_ratio_c1 = 32;
+                        constexpr static const sqrt_ratio_integral_type sqrt_ratio_c3 =
+                            0x2000000000000000000000000000000011234C7E04A67C8DCC969876_cppui_modular222;
+                        constexpr static const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0x3532C03204FBA871900F0174278BFA48A84BDE8A976E4E47A58F2AB23E9EA126_cppui_modular254);
+                        constexpr static const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x3DC271C8308FCA72F0B7A1A19440CCC7325F98710655BAC58F7F70A4CCEFC9E9_cppui_modular254);
+
+                        constexpr static const cofactor_integral_type h_eff = 1;
+                    };
+
+                    /// vesta_XMD:SHA-256_SSWU_RO_ and _NU_, as for pallas
+                    template<>
+                    struct h2c_suite<typename vesta::g1_type<>> {
+                        typedef typename vesta::g1_type<> group_type;
+                        typedef typename group_type::value_type group_value_type;
+
+                        typedef typename group_type::field_type field_type;
+                        typedef typename field_type::value_type field_value_type;
+                        typedef typename vesta::base_field_type base_field_type;
+                        typedef typename base_field_type::integral_type integral_type;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<64>>
+                            cofactor_integral_type;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<222>>
+                            sqrt_ratio_integral_type;
+
+                        typedef expand_message_xmd<sha2_256> expand_message_type;
+
+                        constexpr static const std::size_t m = 1;      ///< extension degree of field_type
+                        constexpr static const std::size_t k = 128;    ///< security level in bits
+                        constexpr static const std::size_t L = 48;     ///< ceil((ceil(log2(p)) + k) / 8)
+
+                        constexpr static const field_value_type Ai = field_value_type(
+                            0x267F9B2EE592271A81639C4D96F787739673928C7D01B212C515AD7242EAA6B1_cppui_modular254);
+                        constexpr static const field_value_type Bi = field_value_type(1265);
+                        /// -13
+                        constexpr static const field_value_type Z = field_value_type(
+                            0x40000000000000000000000000000000224698FC0994A8DD8C46EB20FFFFFFF4_cppui_modular255);
+
+                        /// sqrt_ratio constants of RFC 9380 F.2.1.1
+                        constexpr static const std::size_t sqrt_ratio_c1 = 32;
+                        constexpr static const sqrt_ratio_integral_type sqrt_ratio_c3 =
+                            0x2000000000000000000000000000000011234C7E04CA546EC6237590_cppui_modular222;
+                        constexpr static const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0x16915A9E3A85ECAA11685FD036BE6BF8870326A1C5E594F7BE27D905DD4B42E0_cppui_modular253);
+                        constexpr static const field_value_type sqrt_ratio_c7 = field_value_type(
+                            0x2F5B4405E8F664F4CC83CE90EB785A677D2C72C8B07779A471604D7507C718F6_cppui_modular254);
+
+                        constexpr static const cofactor_integral_type h_eff = 1;
+                    };
+
+                    /// BN254G1_XMD:SHA-256_SVDW_RO_ and _NU_, the Shallue-van de Woestijne map of RFC 9380 6.6.1 to
+                    /// y^2 = x^3 + A * x + B, as in gnark-crypto
+                    template<>
+                    struct h2c_suite<typename alt_bn128_254::g1_type<>> {
+                        typedef typename alt_bn128_254::g1_type<> group_type;
+                        typedef typename group_type::value_type group_value_type;
+
+                        typedef typename group_type::field_type field_type;
+                        typedef typename field_type::value_type field_value_type;
+                        typedef typename alt_bn128_254::base_field_type base_field_type;
+                        typedef typename base_field_type::integral_type integral_type;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<64>>
+                            cofactor_integral_type;
+                        typedef boost::multiprecision::number<
+                            boost::multiprecision::backends::cpp_int_modular_backend<252>>
+                            sqrt_ratio_integral_type;
+
+                        typedef expand_message_xmd<sha2_256> expand_message_type;
+
+                        constexpr static const std::size_t m = 1;      ///< extension degree of field_type
+                        constexpr static const std::size_t k = 128;    ///< security level in bits
+                        constexpr static const std::size_t L = 48;     ///< ceil((ceil(log2(p)) + k) / 8)
+
+                        constexpr static const field_value_type A = field_value_type(0);
+                        constexpr static const field_value_type B = field_value_type(3);
+                        constexpr static const field_value_type Z = field_value_type(1);
+
+                        /// constants of RFC 9380 F.1, c1 = g(Z), c2 = -Z / 2, c3 = sqrt(-g(Z) * (3 * Z^2 + 4 * A))
+                        /// with sgn0(c3) = 0, c4 = -4 * g(Z) / (3 * Z^2 + 4 * A)
+                        constexpr static const field_value_type svdw_c1 = field_value_type(4);
+                        constexpr static const field_value_type svdw_c2 = field_value_type(
+                            0x183227397098D014DC2822DB40C0AC2ECBC0B548B438E5469E10460B6C3E7EA3_cppui_modular253);
+                        constexpr static const field_value_type svdw_c3 = field_value_type(
+                            0x16789AF3A83522EB353C98FC6B36D713D5D8D1CC5DFFFFFFA_cppui_modular193);
+                        constexpr static const field_value_type svdw_c4 = field_value_type(
+                            0x10216F7BA065E00DE81AC1E7808072C9DD2B2385CD7B438469602EB24829A9BD_cppui_modular253);
+
+                        /// sqrt_ratio constants of RFC 9380 F.2.1.1 for the non-square -1, Z being a square
+                        constexpr static const std::size_t sqrt_ratio_c1 = 1;
+                        constexpr static const sqrt_ratio_integral_type sqrt_ratio_c3 =
+                            0xC19139CB84C680A6E14116DA060561765E05AA45A1C72A34F082305B61F3F51_cppui_modular252;
+                        constexpr static const field_value_type sqrt_ratio_c6 = field_value_type(
+                            0x30644E72E131A029B85045B68181585D97816A916871CA8D3C208C16D87CFD46_cppui_modular254);
+                        constexpr static const field_value_type sqrt_ratio_c7 = field_value_type(1);
+
+                        constexpr static const cofactor_integral_type h_eff = 1;
+                    };
+
+                    constexpr std::size_t const h2c_suite<typename secp256k1::g1_type<>>::m;
+                    constexpr std::size_t const h2c_suite<typename secp256k1::g1_type<>>::k;
+                    constexpr std::size_t const h2c_suite<typename secp256k1::g1_type<>>::L;
+                    constexpr typename h2c_suite<typename secp256k1::g1_type<>>::field_value_type const
+                        h2c_suite<typename secp256k1::g1_type<>>::Ai;
+                    constexpr typename h2c_suite<typename secp256k1::g1_type<>>::field_value_type const
+                        h2c_suite<typename secp256k1::g1_type<>>::Bi;
+                    constexpr typename h2c_suite<typename secp256k1::g1_type<>>::field_value_type const
+                        h2c_suite<typename secp256k1::g1_type<>>::Z;
+                    constexpr typename h2c_suite<typename secp256k1::g1_type<>>::cofactor_integral_type const
+                        h2c_suite<typename secp256k1::g1_type<>>::h_eff;
+                    constexpr std::size_t const h2c_suite<typename secp256k1::g1_type<>>::sqrt_ratio_c1;
+                    constexpr typename h2c_suite<typename secp256k1::g1_type<>>::sqrt_ratio_integral_type const
+                        h2c_suite<typename secp256k1::g1_type<>>::sqrt_ratio_c3;
+                    constexpr typename h2c_suite<typename secp256k1::g1_type<>>::field_value_type const
+                        h2c_suite<typename secp256k1::g1_type<>>::sqrt_ratio_c6;
+                    constexpr typename h2c_suite<typename secp256k1::g1_type<>>::field_value_type const
+                        h2c_suite<typename secp256k1::g1_type<>>::sqrt_ratio_c7;
+
+                    constexpr std::size_t const h2c_suite<typename pallas::g1_type<>>::m;
+                    constexpr std::size_t const h2c_suite<typename pallas::g1_type<>>::k;
+                    constexpr std::size_t const h2c_suite<typename pallas::g1_type<>>::L;
+                    constexpr typename h2c_suite<typename pallas::g1_type<>>::field_value_type const
+                        h2c_suite<typename pallas::g1_type<>>::Ai;
+                    constexpr typename h2c_suite<typename pallas::g1_type<>>::field_value_type const
+                        h2c_suite<typename pallas::g1_type<>>::Bi;
+                    constexpr typename h2c_suite<typename pallas::g1_type<>>::field_value_type const
+                        h2c_suite<typename pallas::g1_type<>>::Z;
+                    constexpr typename h2c_suite<typename pallas::g1_type<>>::cofactor_integral_type const
+                        h2c_suite<typename pallas::g1_type<>>::h_eff;
+                    constexpr std::size_t const h2c_suite<typename pallas::g1_type<>>::sqrt_ratio_c1;
+                    constexpr typename h2c_suite<typename pallas::g1_type<>>::sqrt_ratio_integral_type const
+                        h2c_suite<typename pallas::g1_type<>>::sqrt_ratio_c3;
+                    constexpr typename h2c_suite<typename pallas::g1_type<>>::field_value_type const
+                        h2c_suite<typename pallas::g1_type<>>::sqrt_ratio_c6;
+                    constexpr typename h2c_suite<typename pallas::g1_type<>>::field_value_type const
+                        h2c_suite<typename pallas::g1_type<>>::sqrt_ratio_c7;
+
+                    constexpr std::size_t const h2c_suite<typename vesta::g1_type<>>::m;
+                    constexpr std::size_t const h2c_suite<typename vesta::g1_type<>>::k;
+                    constexpr std::size_t const h2c_suite<typename vesta::g1_type<>>::L;
+                    constexpr typename h2c_suite<typename vesta::g1_type<>>::field_value_type const
+                        h2c_suite<typename vesta::g1_type<>>::Ai;
+                    constexpr typename h2c_suite<typename vesta::g1_type<>>::field_value_type const
+                        h2c_suite<typename vesta::g1_type<>>::Bi;
+                    constexpr typename h2c_suite<typename vesta::g1_type<>>::field_value_type const
+                        h2c_suite<typename vesta::g1_type<>>::Z;
+                    constexpr typename h2c_suite<typename vesta::g1_type<>>::cofactor_integral_type const
+                        h2c_suite<typename vesta::g1_type<>>::h_eff;
+                    constexpr std::size_t const h2c_suite<typename vesta::g1_type<>>::sqrt_ratio_c1;
+                    constexpr typename h2c_suite<typename vesta::g1_type<>>::sqrt_ratio_integral_type const
+                        h2c_suite<typename vesta::g1_type<>>::sqrt_ratio_c3;
+                    constexpr typename h2c_suite<typename vesta::g1_type<>>::field_value_type const
+                        h2c_suite<typename vesta::g1_type<>>::sqrt_ratio_c6;
+                    constexpr typename h2c_suite<typename vesta::g1_type<>>::field_value_type const
+                        h2c_suite<typename vesta::g1_type<>>::sqrt_ratio_c7;
+
+                    constexpr std::size_t const h2c_suite<typename alt_bn128_254::g1_type<>>::m;
+                    constexpr std::size_t const h2c_suite<typename alt_bn128_254::g1_type<>>::k;
+                    constexpr std::size_t const h2c_suite<typename alt_bn128_254::g1_type<>>::L;
+                    constexpr typename h2c_suite<typename alt_bn128_254::g1_type<>>::field_value_type const
+                        h2c_suite<typename alt_bn128_254::g1_type<>>::A;
+                    constexpr typename h2c_suite<typename alt_bn128_254::g1_type<>>::field_value_type const
+                        h2c_suite<typename alt_bn128_254::g1_type<>>::B;
+                    constexpr typename h2c_suite<typename alt_bn128_254::g1_type<>>::field_value_type const
+                        h2c_suite<typename alt_bn128_254::g1_type<>>::Z;
+                    constexpr typename h2c_suite<typename alt_bn128_254::g1_type<>>::field_value_type const
+                        h2c_suite<typename alt_bn128_254::g1_type<>>::svdw_c1;
+                    constexpr typename h2c_suite<typename alt_bn128_254::g1_type<>>::field_value_type const
+                        h2c_suite<typename alt_bn128_254::g1_type<>>::svdw_c2;
+                    constexpr typename h2c_suite<typename alt_bn128_254::g1_type<>>::field_value_type const
+                        h2c_suite<typename alt_bn128_254::g1_type<>>::svdw_c3;
+                    constexpr typename h2c_suite<typename alt_bn128_254::g1_type<>>::field_value_type const
+                        h2c_suite<typename alt_bn128_254::g1_type<>>::svdw_c4;
+                    constexpr typename h2c_suite<typename alt_bn128_254::g1_type<>>::cofactor_integral_type const
+                        h2c_suite<typename alt_bn128_254::g1_type<>>::h_eff;
+                    constexpr std::size_t const h2c_suite<typename alt_bn128_254::g1_type<>>::sqrt_ratio_c1;
+                    constexpr typename h2c_suite<typename alt_bn128_254::g1_type<>>::sqrt_ratio_integral_type const
+                        h2c_suite<typename alt_bn128_254::g1_type<>>::sqrt_ratio_c3;
+                    constexpr typename h2c_suite<typename alt_bn128_254::g1_type<>>::field_value_type const
+                        h2c_suite<typename alt_bn128_254::g1_type<>>::sqrt_ratio_c6;
+                    constexpr typename h2c_suite<typename alt_bn128_254::g1_type<>>::field_value_type const
+                        h2c_suite<typename alt_bn128_254::g1_type<>>::sqrt_ratio_c7;
+
+                    /** @brief hash_to_field of RFC 9380 5.2, Count elements of the suite field out of msg and DST.
+                     *
+                     *  Each L-byte string is reduced modulo p by Horner's rule over chunks shorter than p, in
+                     *  Montgomery form, so the reduction takes the same steps whatever the message.
+                     */
+                    template<typename GroupType>
+                    struct hash_to_field {
+                        typedef h2c_suite<GroupType> suite_type;
+
+                        typedef typename suite_type::field_value_type field_value_type;
+                        typedef typename suite_type::base_field_type base_field_type;
+                        typedef typename base_field_type::value_type base_value_type;
+                        typedef typename suite_type::integral_type integral_type;
+
+                        constexpr static const std::size_t m = suite_type::m;
+                        constexpr static const std::size_t L = suite_type::L;
+
+                        template<std::size_t Count, typename MsgRange, typename DstRange>
+                        static inline std::array<field_value_type, Count> process(const MsgRange &msg,
+                                                                                  const DstRange &dst) {
+                            const std::vector<std::uint8_t> uniform_bytes =
+                                suite_type::expand_message_type::process(msg, dst, Count * m * L);
+
+                            std::array<field_value_type, Count> result;
+                            for (std::size_t i = 0; i < Count; ++i) {
+                                std::array<base_value_type, m> e;
+                                for (std::size_t j = 0; j < m; ++j) {
+                                    e[j] = octets_to_base_value(uniform_bytes.cbegin() + L * (j + i * m));
+                                }
+                                result[i] = make_field_value(e);
+                            }
+                            return result;
+                        }
+
+                    private:
+                        /// OS2IP(tv) mod p for the L octets starting at first
+                        template<typename InputIterator>
+                        static inline base_value_type octets_to_base_value(InputIterator first) {
+                            // chunks of chunk_size octets are below p and convert to the field without reduction
+                            constexpr static const std::size_t chunk_size = (base_field_type::modulus_bits - 1) / 8;
+                            static const base_value_type chunk_shift = base_value_type(2).pow(8 * chunk_size);
+
+                            base_value_type result = base_value_type::zero();
+                            std::size_t chunk_length = (L % chunk_size == 0) ? chunk_size : L % chunk_size;
+                            for (std::size_t offset = 0; offset < L;
+                                 offset += chunk_length, chunk_length = chunk_size) {
+                                integral_type chunk;
+                                boost::multiprecision::import_bits(chunk, first + offset, first + offset + chunk_length,
+                                                                   8, true);
+                                result = result * chunk_shift + base_value_type(chunk);
+                            }
+                            return result;
+                        }
+
+                        static inline field_value_type make_field_value(const std::array<base_value_type, 1> &e) {
+                            return e[0];
+                        }
+
+                        template<std::size_t M>
+                        static inline field_value_type make_field_value(const std::array<base_value_type, M> &e) {
+                            typename field_value_type::data_type data;
+                            std::copy(e.begin(), e.end(), data.begin());
+                            return field_value_type(data);
+                        }
+                    };
+                }    // namespace detail
+            }        // namespace curves
+        }            // namespace algebra
+    }                // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_CURVES_HASH_TO_CURVE_SUITES_HPP
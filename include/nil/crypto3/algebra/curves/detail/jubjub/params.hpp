@@ -121,10 +121,15 @@ namespace nil {
                                 0x52a47af6ec47deb77d663b6a45b148d1ccdaa4e2299ecfbd5504c409b3ea62c0_cppui_modular255),
                             typename field_type::value_type(
                                 0x399b020832f6a499ba9d5334ca932dc9faaeea860e9a49a8f8854f55f3b676d4_cppui_modular254)};
+
+                        constexpr static const typename field_type::value_type a24 =
+                            typename field_type::value_type(0x2801u);    ///< (A + 2) / 4 for the xz ladder
                     };
 
                     constexpr std::array<typename jubjub_g1_params<forms::montgomery>::base_field_type::value_type,
                                          2> const jubjub_g1_params<forms::montgomery>::one_fill;
+                    constexpr typename jubjub_g1_params<forms::montgomery>::field_type::value_type const
+                        jubjub_g1_params<forms::montgomery>::a24;
                 }    // namespace detail
             }        // namespace curves
         }            // namespace algebra
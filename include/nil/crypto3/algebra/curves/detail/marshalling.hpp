@@ -27,18 +27,78 @@
 #define CRYPTO3_MARSHALLING_ALGEBRA_CURVES_HPP
 
 #include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
+#include <boost/assert.hpp>
 #include <boost/concept/assert.hpp>
 
+#include <algorithm>
+#include <array>
+#include <future>
 #include <iterator>
+#include <type_traits>
+#include <vector>
 
 namespace nil {
     namespace marshalling {
 
         using namespace nil::crypto3;
 
+        /// What is checked on a decoded point
+        namespace validation_levels {
+            /// Nothing, for trusted data such as a cache written by this process
+            struct none { };
+            /// The point is on the curve
+            struct on_curve { };
+            /// The point is on the curve and in the subgroup of order the scalar field modulus
+            struct subgroup { };
+        }    // namespace validation_levels
+
+        namespace detail {
+            template<typename GroupValueType>
+            inline bool is_valid_point(const GroupValueType &, validation_levels::none) {
+                return true;
+            }
+
+            template<typename GroupValueType>
+            inline bool is_valid_point(const GroupValueType &point, validation_levels::on_curve) {
+                return point.is_well_formed();
+            }
+
+            template<typename GroupValueType>
+            inline bool is_valid_point(const GroupValueType &point, validation_levels::subgroup) {
+                return point.is_well_formed() && algebra::curves::detail::subgroup_check(point);
+            }
+
+            template<typename ValidationLevel, typename GroupValueType>
+            inline bool is_valid_point(const GroupValueType &point) {
+                return is_valid_point(point, ValidationLevel());
+            }
+
+            /// Runs process(chunk_begin, chunk_end) over at most threads_count contiguous chunks of
+            /// [0, total_size), the calling thread taking the first one. True if all the chunks are.
+            template<typename ChunkProcessor>
+            bool parallel_chunks(std::size_t total_size, std::size_t threads_count, const ChunkProcessor &process) {
+                threads_count = std::max<std::size_t>(1, std::min(threads_count, total_size));
+                const std::size_t one_chunk_size = total_size / threads_count;
+
+                std::vector<std::future<bool>> results;
+                for (std::size_t i = 1; i < threads_count; ++i) {
+                    const std::size_t begin = i * one_chunk_size;
+                    const std::size_t end = (i == threads_count - 1) ? total_size : begin + one_chunk_size;
+                    results.emplace_back(std::async(std::launch::async, process, begin, end));
+                }
+
+                bool result = process(0, threads_count == 1 ? total_size : one_chunk_size);
+                for (auto &chunk_result : results) {
+                    result &= chunk_result.get();
+                }
+                return result;
+            }
+        }    // namespace detail
+
         template<typename CurveType>
         class curve_element_serializer { };
 
@@ -145,42 +205,106 @@ namespace nil {
             // TODO: use iterators
             // Deserialization procedure according to
             // https://datatracker.ietf.org/doc/html/draft-irtf-cfrg-pairing-friendly-curves-09#appendix-C.2
-            template<typename PointOctetsRange,
+            /** @brief Decodes a compressed or uncompressed G1 encoding into result. Returns false, leaving
+             *  result unchanged, if the encoding is malformed or not canonical, if no point of the curve has
+             *  the encoded x, or if the point fails the checks of ValidationLevel.
+             */
+            template<typename ValidationLevel = validation_levels::on_curve, typename PointOctetsRange,
                      typename = typename std::enable_if<
                          std::is_same<std::uint8_t, typename PointOctetsRange::value_type>::value>::type>
-            static inline g1_value_type octets_to_g1_point(const PointOctetsRange &octets) {
+            static inline bool octets_to_g1_point(const PointOctetsRange &octets, g1_value_type &result) {
                 BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<PointOctetsRange>));
 
-                const std::uint8_t m_byte = *octets.begin() & 0xE0;
-                BOOST_ASSERT(m_byte != 0x20 && m_byte != 0x60 && m_byte != 0xE0);
-
-                PointOctetsRange point_octets = octets;
-                *point_octets.begin() &= 0x1F;
-
-                if (m_byte & C_bit) {
-                    return compressed_to_g1_point(point_octets, m_byte);
+                if (std::begin(octets) == std::end(octets)) {
+                    return false;
                 }
-                return uncompressed_to_g1_point(point_octets, m_byte);
+                if (*std::begin(octets) & C_bit) {
+                    return compressed_to_g1_point<ValidationLevel>(octets, result);
+                }
+                return uncompressed_to_g1_point<ValidationLevel>(octets, result);
             }
 
             // TODO: use iterators
-            template<typename PointOctetsRange,
+            /// Same as octets_to_g1_point for G2.
+            template<typename ValidationLevel = validation_levels::on_curve, typename PointOctetsRange,
                      typename = typename std::enable_if<
                          std::is_same<std::uint8_t, typename PointOctetsRange::value_type>::value>::type>
-            static inline g2_value_type octets_to_g2_point(const PointOctetsRange &octets) {
+            static inline bool octets_to_g2_point(const PointOctetsRange &octets, g2_value_type &result) {
                 BOOST_CONCEPT_ASSERT((boost::SinglePassRangeConcept<PointOctetsRange>));
 
-                const std::uint8_t m_byte = *octets.begin() & 0xE0;
-                BOOST_ASSERT(m_byte != 0x20 && m_byte != 0x60 && m_byte != 0xE0);
+                if (std::begin(octets) == std::end(octets)) {
+                    return false;
+                }
+                if (*std::begin(octets) & C_bit) {
+                    return compressed_to_g2_point<ValidationLevel>(octets, result);
+                }
+                return uncompressed_to_g2_point<ValidationLevel>(octets, result);
+            }
+
+            /** @brief Decompresses the compressed G1 encodings in [first, last) into affine points at out.
+             *  The square test is fused into the square root: p = 3 (mod 4), so y = (x^3 + 4)^((p+1)/4) is
+             *  checked by one squaring, one exponentiation per point. The input is split into threads_count
+             *  chunks decompressed in parallel.
+             *  Returns false if any encoding is malformed, not canonical or fails the checks of
+             *  ValidationLevel, out is then left partially written. An x with no point on the curve is
+             *  rejected whatever the level, as the square test is a single squaring.
+             */
+            template<typename ValidationLevel = validation_levels::on_curve, typename OctetsRandomAccessIterator,
+                     typename AffineRandomAccessIterator>
+            static bool batch_octets_to_g1(OctetsRandomAccessIterator first, OctetsRandomAccessIterator last,
+                                           AffineRandomAccessIterator out, std::size_t threads_count = 1) {
+                return detail::parallel_chunks(
+                    std::distance(first, last), threads_count, [first, out](std::size_t begin, std::size_t end) {
+                        return compressed_to_g1_affine_points<ValidationLevel>(first + begin, first + end,
+                                                                               out + begin);
+                    });
+            }
 
-                PointOctetsRange point_octets;
-                std::copy(octets.begin(), octets.end(), point_octets.begin());
-                *point_octets.begin() &= 0x1F;
+            /** @brief Decompresses the compressed G2 encodings in [first, last) into affine points at out.
+             *  Square roots in Fp2 take two Fp exponentiations, the square test being fused into the first
+             *  one, and one Fp inversion that is shared by all the points of a chunk.
+             *  Same results and threading as batch_octets_to_g1.
+             */
+            template<typename ValidationLevel = validation_levels::on_curve, typename OctetsRandomAccessIterator,
+                     typename AffineRandomAccessIterator>
+            static bool batch_octets_to_g2(OctetsRandomAccessIterator first, OctetsRandomAccessIterator last,
+                                           AffineRandomAccessIterator out, std::size_t threads_count = 1) {
+                return detail::parallel_chunks(
+                    std::distance(first, last), threads_count, [first, out](std::size_t begin, std::size_t end) {
+                        return compressed_to_g2_affine_points<ValidationLevel>(first + begin, first + end,
+                                                                               out + begin);
+                    });
+            }
 
-                if (m_byte & C_bit) {
-                    return compressed_to_g2_point(point_octets, m_byte);
-                }
-                return uncompressed_to_g2_point(point_octets, m_byte);
+            /** @brief Reads the uncompressed G1 encodings in [first, last) into affine points at out.
+             *  With validation_levels::none the coordinates are only imported, which is the way to load
+             *  points this process wrote itself. Same results and threading as batch_octets_to_g1.
+             */
+            template<typename ValidationLevel = validation_levels::on_curve, typename OctetsRandomAccessIterator,
+                     typename AffineRandomAccessIterator>
+            static bool batch_uncompressed_octets_to_g1(OctetsRandomAccessIterator first,
+                                                        OctetsRandomAccessIterator last,
+                                                        AffineRandomAccessIterator out,
+                                                        std::size_t threads_count = 1) {
+                return detail::parallel_chunks(
+                    std::distance(first, last), threads_count, [first, out](std::size_t begin, std::size_t end) {
+                        return uncompressed_to_g1_affine_points<ValidationLevel>(first + begin, first + end,
+                                                                                 out + begin);
+                    });
+            }
+
+            /// Same as batch_uncompressed_octets_to_g1 for G2.
+            template<typename ValidationLevel = validation_levels::on_curve, typename OctetsRandomAccessIterator,
+                     typename AffineRandomAccessIterator>
+            static bool batch_uncompressed_octets_to_g2(OctetsRandomAccessIterator first,
+                                                        OctetsRandomAccessIterator last,
+                                                        AffineRandomAccessIterator out,
+                                                        std::size_t threads_count = 1) {
+                return detail::parallel_chunks(
+                    std::distance(first, last), threads_count, [first, out](std::size_t begin, std::size_t end) {
+                        return uncompressed_to_g2_affine_points<ValidationLevel>(first + begin, first + end,
+                                                                                 out + begin);
+                    });
             }
 
         protected:
@@ -190,117 +314,378 @@ namespace nil {
             // constexpr static const typename g1_field_value_type::integral_type half_p =
             //     (g1_field_value_type::modulus - integral_type(1)) / integral_type(2);
 
-            template<typename PointOctetsRange,
-                     typename = typename std::enable_if<
-                         std::is_same<std::uint8_t, typename PointOctetsRange::value_type>::value>::type>
-            static inline g1_value_type compressed_to_g1_point(PointOctetsRange &point_octets, std::uint8_t m_byte) {
-                BOOST_ASSERT(std::distance(point_octets.begin(), point_octets.end()) == sizeof_field_element);
+            template<typename ValidationLevel, typename PointOctetsRange>
+            static inline bool compressed_to_g1_point(const PointOctetsRange &octets, g1_value_type &result) {
+                std::uint8_t m_byte;
+                if (!read_compressed_flags(octets, sizeof_field_element, m_byte)) {
+                    return false;
+                }
+                if (m_byte & I_bit) {
+                    result = g1_value_type();    // point at infinity
+                    return true;
+                }
 
+                g1_field_value_type x;
+                if (!read_field_element(std::begin(octets), true, x)) {
+                    return false;
+                }
+                const g1_field_value_type y2 = x.squared() * x + g1_field_value_type(4u);
+                if (!y2.is_square()) {
+                    return false;
+                }
+                g1_field_value_type y = y2.sqrt();
+                if (sign_gf_p(y) != bool(m_byte & S_bit)) {
+                    y = -y;
+                }
+                return set_if_valid<ValidationLevel>(g1_value_type(x, y, g1_field_value_type::one()), result);
+            }
+
+            template<typename ValidationLevel, typename PointOctetsRange>
+            static inline bool uncompressed_to_g1_point(const PointOctetsRange &octets, g1_value_type &result) {
+                std::uint8_t m_byte;
+                if (!read_uncompressed_flags(octets, 2 * sizeof_field_element, m_byte)) {
+                    return false;
+                }
                 if (m_byte & I_bit) {
-                    BOOST_ASSERT(point_octets.end() == std::find(point_octets.begin(), point_octets.end(), true));
-                    return g1_value_type();    // point at infinity
-                }
-
-                integral_type x;
-                boost::multiprecision::import_bits(x, point_octets.rbegin(), point_octets.rend(), 8, false);
-                g1_field_value_type x_mod(x);
-                g1_field_value_type y2_mod = x_mod.pow(3u) + g1_field_value_type(4u);
-                BOOST_ASSERT(y2_mod.is_square());
-                g1_field_value_type y_mod = y2_mod.sqrt();
-                bool Y_bit = sign_gf_p(y_mod);
-                if (Y_bit == bool(m_byte & S_bit)) {
-                    g1_value_type result(x_mod, y_mod, g1_field_value_type::one());
-                    BOOST_ASSERT(result.is_well_formed());
-                    return result;
-                }
-                g1_value_type result(x_mod, -y_mod, g1_field_value_type::one());
-                BOOST_ASSERT(result.is_well_formed());
-                return result;
+                    result = g1_value_type();    // point at infinity
+                    return true;
+                }
+
+                g1_field_value_type x, y;
+                if (!read_field_element(std::begin(octets), true, x) ||
+                    !read_field_element(std::next(std::begin(octets), sizeof_field_element), false, y)) {
+                    return false;
+                }
+                return set_if_valid<ValidationLevel>(g1_value_type(x, y, g1_field_value_type::one()), result);
             }
 
-            template<typename PointOctetsRange,
-                     typename = typename std::enable_if<
-                         std::is_same<std::uint8_t, typename PointOctetsRange::value_type>::value>::type>
-            static inline g1_value_type uncompressed_to_g1_point(PointOctetsRange &point_octets, std::uint8_t m_byte) {
-                BOOST_ASSERT(std::distance(point_octets.begin(), point_octets.end()) == 2 * sizeof_field_element);
+            template<typename ValidationLevel, typename PointOctetsRange>
+            static inline bool compressed_to_g2_point(const PointOctetsRange &octets, g2_value_type &result) {
+                std::uint8_t m_byte;
+                if (!read_compressed_flags(octets, 2 * sizeof_field_element, m_byte)) {
+                    return false;
+                }
+                if (m_byte & I_bit) {
+                    result = g2_value_type();    // point at infinity
+                    return true;
+                }
+
+                // x_1 | x_0
+                g1_field_value_type x_0, x_1;
+                if (!read_field_element(std::begin(octets), true, x_1) ||
+                    !read_field_element(std::next(std::begin(octets), sizeof_field_element), false, x_0)) {
+                    return false;
+                }
+                const g2_field_value_type x(x_0, x_1);
+                const g2_field_value_type y2 = x.squared() * x + g2_field_value_type(4u, 4u);
+                if (!y2.is_square()) {
+                    return false;
+                }
+                g2_field_value_type y = y2.sqrt();
+                if (sign_gf_p(y) != bool(m_byte & S_bit)) {
+                    y = -y;
+                }
+                return set_if_valid<ValidationLevel>(g2_value_type(x, y, g2_field_value_type::one()), result);
+            }
 
+            template<typename ValidationLevel, typename PointOctetsRange>
+            static inline bool uncompressed_to_g2_point(const PointOctetsRange &octets, g2_value_type &result) {
+                std::uint8_t m_byte;
+                if (!read_uncompressed_flags(octets, 4 * sizeof_field_element, m_byte)) {
+                    return false;
+                }
                 if (m_byte & I_bit) {
-                    BOOST_ASSERT(point_octets.end() == std::find(point_octets.begin(), point_octets.end(), true));
-                    return g1_value_type();    // point at infinity
+                    result = g2_value_type();    // point at infinity
+                    return true;
                 }
 
-                integral_type x, y;
-                boost::multiprecision::import_bits(
-                    y, point_octets.rbegin(), point_octets.rbegin() + sizeof_field_element, 8, false);
-                boost::multiprecision::import_bits(
-                    x, point_octets.rbegin() + sizeof_field_element, point_octets.rend(), 8, false);
-                g1_value_type result(g1_field_value_type(x), g1_field_value_type(y), g1_field_value_type::one());
-                BOOST_ASSERT(result.is_well_formed());
-                return result;
+                // x_1 | x_0 | y_1 | y_0
+                std::array<g1_field_value_type, 4> coordinates;
+                for (std::size_t i = 0; i < coordinates.size(); ++i) {
+                    if (!read_field_element(std::next(std::begin(octets), i * sizeof_field_element), i == 0,
+                                            coordinates[i])) {
+                        return false;
+                    }
+                }
+                return set_if_valid<ValidationLevel>(
+                    g2_value_type(g2_field_value_type(coordinates[1], coordinates[0]),
+                                  g2_field_value_type(coordinates[3], coordinates[2]), g2_field_value_type::one()),
+                    result);
             }
 
-            template<typename PointOctetsRange,
-                     typename = typename std::enable_if<
-                         std::is_same<std::uint8_t, typename PointOctetsRange::value_type>::value>::type>
-            static inline g2_value_type compressed_to_g2_point(PointOctetsRange &point_octets, std::uint8_t m_byte) {
-                BOOST_ASSERT(std::distance(point_octets.begin(), point_octets.end()) == 2 * sizeof_field_element);
+            /// Stores point into result if it passes the checks of ValidationLevel
+            template<typename ValidationLevel, typename GroupValueType>
+            static inline bool set_if_valid(const GroupValueType &point, GroupValueType &result) {
+                if (!detail::is_valid_point<ValidationLevel>(point)) {
+                    return false;
+                }
+                result = point;
+                return true;
+            }
 
+            /// Reads the flags of a compressed encoding of size octets_size. Infinity must be all zeros
+            /// but the flags.
+            template<typename PointOctets>
+            static inline bool read_compressed_flags(const PointOctets &octets, std::size_t octets_size,
+                                                     std::uint8_t &m_byte) {
+                if (static_cast<std::size_t>(std::distance(std::begin(octets), std::end(octets))) != octets_size) {
+                    return false;
+                }
+
+                m_byte = *std::begin(octets) & 0xE0;
+                if (!(m_byte & C_bit) || m_byte == 0xE0) {
+                    return false;
+                }
                 if (m_byte & I_bit) {
-                    BOOST_ASSERT(point_octets.end() == std::find(point_octets.begin(), point_octets.end(), true));
-                    return g2_value_type();    // point at infinity
-                }
-
-                integral_type x_0, x_1;
-                boost::multiprecision::import_bits(
-                    x_0, point_octets.rbegin(), point_octets.rbegin() + sizeof_field_element, 8, false);
-                boost::multiprecision::import_bits(
-                    x_1, point_octets.rbegin() + sizeof_field_element, point_octets.rend(), 8, false);
-                g2_field_value_type x_mod(x_0, x_1);
-                g2_field_value_type y2_mod = x_mod.pow(3u) + g2_field_value_type(4u, 4u);
-                BOOST_ASSERT(y2_mod.is_square());
-                g2_field_value_type y_mod = y2_mod.sqrt();
-                bool Y_bit = sign_gf_p(y_mod);
-                if (Y_bit == bool(m_byte & S_bit)) {
-                    g2_value_type result(x_mod, y_mod, g2_field_value_type::one());
-                    BOOST_ASSERT(result.is_well_formed());
-                    return result;
-                }
-                g2_value_type result(x_mod, -y_mod, g2_field_value_type::one());
-                BOOST_ASSERT(result.is_well_formed());
-                return result;
+                    return (*std::begin(octets) & 0x1F) == 0 &&
+                           std::all_of(std::next(std::begin(octets)), std::end(octets),
+                                       [](std::uint8_t octet) { return octet == 0; });
+                }
+                return true;
             }
 
-            template<typename PointOctetsRange,
-                     typename = typename std::enable_if<
-                         std::is_same<std::uint8_t, typename PointOctetsRange::value_type>::value>::type>
-            static inline g2_value_type uncompressed_to_g2_point(PointOctetsRange &point_octets, std::uint8_t m_byte) {
-                BOOST_ASSERT(std::distance(point_octets.begin(), point_octets.end()) == 4 * sizeof_field_element);
+            /// Reads the big-endian field element starting at octets_begin, with the flag bits cleared
+            /// if clear_flags is set. Rejects values not reduced modulo p.
+            template<typename OctetsIterator>
+            static inline bool read_field_element(OctetsIterator octets_begin, bool clear_flags,
+                                                  g1_field_value_type &result) {
+                std::array<std::uint8_t, sizeof_field_element> octets;
+                std::copy_n(octets_begin, sizeof_field_element, octets.begin());
+                if (clear_flags) {
+                    octets[0] &= 0x1F;
+                }
+
+                integral_type value;
+                boost::multiprecision::import_bits(value, octets.begin(), octets.end(), 8, true);
+                if (value >= g1_field_value_type::modulus) {
+                    return false;
+                }
+                result = g1_field_value_type(value);
+                return true;
+            }
+
+            /// (p+1)/4: a^((p+1)/4) is a square root of a if a is a square and of -a otherwise.
+            static inline const integral_type &sqrt_exponent() {
+                static const integral_type exponent = (g1_field_value_type::modulus + integral_type(1)) / 4;
+                return exponent;
+            }
 
+            /// Reads the flags of an uncompressed encoding of size octets_size. Infinity must be all zeros
+            /// but the flags.
+            template<typename PointOctets>
+            static inline bool read_uncompressed_flags(const PointOctets &octets, std::size_t octets_size,
+                                                       std::uint8_t &m_byte) {
+                if (static_cast<std::size_t>(std::distance(std::begin(octets), std::end(octets))) != octets_size) {
+                    return false;
+                }
+
+                m_byte = *std::begin(octets) & 0xE0;
+                if (m_byte != 0 && m_byte != I_bit) {
+                    return false;
+                }
                 if (m_byte & I_bit) {
-                    BOOST_ASSERT(point_octets.end() == std::find(point_octets.begin(), point_octets.end(), true));
-                    return g2_value_type();    // point at infinity
-                }
-
-                integral_type x_0, x_1, y_0, y_1;
-                boost::multiprecision::import_bits(
-                    y_0, point_octets.rbegin(), point_octets.rbegin() + sizeof_field_element, 8, false);
-                boost::multiprecision::import_bits(y_1,
-                                            point_octets.rbegin() + sizeof_field_element,
-                                            point_octets.rbegin() + 2 * sizeof_field_element,
-                                            8,
-                                            false);
-                boost::multiprecision::import_bits(x_0,
-                                            point_octets.rbegin() + 2 * sizeof_field_element,
-                                            point_octets.rbegin() + 3 * sizeof_field_element,
-                                            8,
-                                            false);
-                boost::multiprecision::import_bits(
-                    x_1, point_octets.rbegin() + 3 * sizeof_field_element, point_octets.rend(), 8, false);
-                g2_value_type result(g2_field_value_type(g1_field_value_type(x_0), g1_field_value_type(x_1)),
-                                     g2_field_value_type(g1_field_value_type(y_0), g1_field_value_type(y_1)),
-                                     g2_field_value_type::one());
-                BOOST_ASSERT(result.is_well_formed());
-                return result;
+                    return (*std::begin(octets) & 0x1F) == 0 &&
+                           std::all_of(std::next(std::begin(octets)), std::end(octets),
+                                       [](std::uint8_t octet) { return octet == 0; });
+                }
+                return true;
+            }
+
+            /// The subgroup check of validation_levels::subgroup on a point known to be on the curve
+            template<typename ValidationLevel, typename GroupValueType>
+            static inline bool check_subgroup(const GroupValueType &point) {
+                if (std::is_same<ValidationLevel, validation_levels::subgroup>::value) {
+                    return algebra::curves::detail::subgroup_check(point);
+                }
+                return true;
+            }
+
+            template<typename ValidationLevel, typename OctetsIterator, typename AffineIterator>
+            static bool uncompressed_to_g1_affine_points(OctetsIterator first, OctetsIterator last,
+                                                         AffineIterator out) {
+                for (; first != last; ++first, ++out) {
+                    std::uint8_t m_byte;
+                    if (!read_uncompressed_flags(*first, 2 * sizeof_field_element, m_byte)) {
+                        return false;
+                    }
+                    if (m_byte & I_bit) {
+                        *out = g1_affine_value_type::zero();
+                        continue;
+                    }
+
+                    g1_field_value_type x, y;
+                    if (!read_field_element(std::begin(*first), true, x) ||
+                        !read_field_element(std::next(std::begin(*first), sizeof_field_element), false, y)) {
+                        return false;
+                    }
+                    if (!detail::is_valid_point<ValidationLevel>(
+                            g1_value_type(x, y, g1_field_value_type::one()))) {
+                        return false;
+                    }
+                    *out = g1_affine_value_type(x, y);
+                }
+                return true;
+            }
+
+            template<typename ValidationLevel, typename OctetsIterator, typename AffineIterator>
+            static bool uncompressed_to_g2_affine_points(OctetsIterator first, OctetsIterator last,
+                                                         AffineIterator out) {
+                for (; first != last; ++first, ++out) {
+                    std::uint8_t m_byte;
+                    if (!read_uncompressed_flags(*first, 4 * sizeof_field_element, m_byte)) {
+                        return false;
+                    }
+                    if (m_byte & I_bit) {
+                        *out = g2_affine_value_type::zero();
+                        continue;
+                    }
+
+                    // x_1 | x_0 | y_1 | y_0
+                    std::array<g1_field_value_type, 4> coordinates;
+                    for (std::size_t i = 0; i < coordinates.size(); ++i) {
+                        if (!read_field_element(std::next(std::begin(*first), i * sizeof_field_element), i == 0,
+                                                coordinates[i])) {
+                            return false;
+                        }
+                    }
+                    const g2_field_value_type x(coordinates[1], coordinates[0]), y(coordinates[3], coordinates[2]);
+                    if (!detail::is_valid_point<ValidationLevel>(
+                            g2_value_type(x, y, g2_field_value_type::one()))) {
+                        return false;
+                    }
+                    *out = g2_affine_value_type(x, y);
+                }
+                return true;
+            }
+
+            template<typename ValidationLevel, typename OctetsIterator, typename AffineIterator>
+            static bool compressed_to_g1_affine_points(OctetsIterator first, OctetsIterator last, AffineIterator out) {
+                for (; first != last; ++first, ++out) {
+                    std::uint8_t m_byte;
+                    if (!read_compressed_flags(*first, sizeof_field_element, m_byte)) {
+                        return false;
+                    }
+                    if (m_byte & I_bit) {
+                        *out = g1_affine_value_type::zero();
+                        continue;
+                    }
+
+                    g1_field_value_type x;
+                    if (!read_field_element(std::begin(*first), true, x)) {
+                        return false;
+                    }
+                    const g1_field_value_type y2 = x.squared() * x + g1_field_value_type(4u);
+                    g1_field_value_type y = y2.pow(sqrt_exponent());
+                    if (y.squared() != y2) {
+                        return false;
+                    }
+                    if (sign_gf_p(y) != bool(m_byte & S_bit)) {
+                        y = -y;
+                    }
+                    if (!check_subgroup<ValidationLevel>(g1_value_type(x, y, g1_field_value_type::one()))) {
+                        return false;
+                    }
+                    *out = g1_affine_value_type(x, y);
+                }
+                return true;
+            }
+
+            template<typename ValidationLevel, typename OctetsIterator, typename AffineIterator>
+            static bool compressed_to_g2_affine_points(OctetsIterator first, OctetsIterator last, AffineIterator out) {
+                static const g1_field_value_type two_inv = g1_field_value_type(2u).inversed();
+
+                const std::size_t size = std::distance(first, last);
+
+                // Square roots of y^2 = a0 + a1 * u, with u^2 = -1 and a1 != 0, from the square root s of the
+                // norm a0^2 + a1^2 and c = t^((p+1)/4), t = (a0 + s) / 2:
+                // y = c + a1 / (2c) * u if c^2 = t, y = a1 / (2c) + c * u if c^2 = -t.
+                std::vector<g2_field_value_type> x(size), y2(size);
+                std::vector<g1_field_value_type> c(size);
+                std::vector<bool> is_t_square(size);
+                std::vector<std::uint8_t> m_bytes(size);
+
+                std::vector<std::size_t> inversion_indices;
+                std::vector<g1_field_value_type> inversion_values;
+
+                OctetsIterator octets = first;
+                for (std::size_t i = 0; i < size; ++i, ++octets) {
+                    if (!read_compressed_flags(*octets, 2 * sizeof_field_element, m_bytes[i])) {
+                        return false;
+                    }
+                    if (m_bytes[i] & I_bit) {
+                        continue;
+                    }
+
+                    g1_field_value_type x_0, x_1;
+                    if (!read_field_element(std::begin(*octets), true, x_1) ||
+                        !read_field_element(std::next(std::begin(*octets), sizeof_field_element), false, x_0)) {
+                        return false;
+                    }
+                    x[i] = g2_field_value_type(x_0, x_1);
+                    y2[i] = x[i].squared() * x[i] + g2_field_value_type(4u, 4u);
+
+                    const g1_field_value_type &a0 = y2[i].data[0], &a1 = y2[i].data[1];
+                    if (a1.is_zero()) {
+                        // y^2 in Fp: -1 is not a square, so exactly one of a0 and -a0 is
+                        c[i] = a0.pow(sqrt_exponent());
+                        continue;
+                    }
+
+                    const g1_field_value_type norm = a0.squared() + a1.squared();
+                    const g1_field_value_type s = norm.pow(sqrt_exponent());
+                    if (s.squared() != norm) {
+                        return false;
+                    }
+                    const g1_field_value_type t = (a0 + s) * two_inv;
+                    c[i] = t.pow(sqrt_exponent());
+                    is_t_square[i] = (c[i].squared() == t);
+
+                    inversion_indices.push_back(i);
+                    inversion_values.push_back(c[i].doubled());
+                }
+
+                // Montgomery's trick: one inversion for all the 1 / (2c) of the chunk
+                std::vector<g1_field_value_type> prefix_products(inversion_values.size());
+                g1_field_value_type product = g1_field_value_type::one();
+                for (std::size_t j = 0; j < inversion_values.size(); ++j) {
+                    prefix_products[j] = product;
+                    product = product * inversion_values[j];
+                }
+                g1_field_value_type product_inv = product.inversed();
+                for (std::size_t j = inversion_values.size(); j-- > 0;) {
+                    const g1_field_value_type value_inv = product_inv * prefix_products[j];
+                    product_inv = product_inv * inversion_values[j];
+                    inversion_values[j] = value_inv;
+                }
+
+                std::size_t j = 0;
+                for (std::size_t i = 0; i < size; ++i, ++out) {
+                    if (m_bytes[i] & I_bit) {
+                        *out = g2_affine_value_type::zero();
+                        continue;
+                    }
+
+                    g2_field_value_type y;
+                    const g1_field_value_type &a1 = y2[i].data[1];
+                    if (a1.is_zero()) {
+                        y = (c[i].squared() == y2[i].data[0]) ? g2_field_value_type(c[i], g1_field_value_type::zero()) :
+                                                                g2_field_value_type(g1_field_value_type::zero(), c[i]);
+                    } else {
+                        BOOST_ASSERT(inversion_indices[j] == i);
+                        const g1_field_value_type d = a1 * inversion_values[j++];
+                        y = is_t_square[i] ? g2_field_value_type(c[i], d) : g2_field_value_type(d, c[i]);
+                    }
+                    BOOST_ASSERT(y.squared() == y2[i]);
+
+                    if (sign_gf_p(y) != bool(m_bytes[i] & S_bit)) {
+                        y = -y;
+                    }
+                    if (!check_subgroup<ValidationLevel>(g2_value_type(x[i], y, g2_field_value_type::one()))) {
+                        return false;
+                    }
+                    *out = g2_affine_value_type(x[i], y);
+                }
+                return true;
             }
 
             static inline bool sign_gf_p(const g1_field_value_type &v) {
@@ -26,20 +26,86 @@
 #ifndef CRYPTO3_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP
 #define CRYPTO3_ALGEBRA_CURVES_SUBGROUP_CHECK_HPP
 
+#include <type_traits>
+
 #include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/curves/detail/endomorphisms.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace algebra {
             namespace curves {
+                /// How subgroup_check decides that a point is in the subgroup of order the scalar field modulus
+                namespace subgroup_check_methods {
+                    /// The point times the subgroup order is zero
+                    struct scalar_mul { };
+                    /// sigma(x, y) = (cube_root_of_unity * x, y) acts as the multiplication by the eigenvalue
+                    struct sigma_endomorphism { };
+                    /// psi, the untwist-Frobenius-twist endomorphism, acts as the multiplication by the eigenvalue
+                    struct psi_endomorphism { };
+                }    // namespace subgroup_check_methods
+
                 namespace detail {
+                    template<typename GroupType, typename = void>
+                    struct subgroup_check_method {
+                        typedef subgroup_check_methods::scalar_mul type;
+                    };
+
+                    template<typename GroupType>
+                    struct subgroup_check_method<GroupType,
+                                                 decltype(void(GroupType::params_type::cube_root_of_unity))> {
+                        typedef subgroup_check_methods::sigma_endomorphism type;
+                    };
+
+                    template<typename GroupType>
+                    struct subgroup_check_method<
+                        GroupType, typename std::enable_if<has_psi<typename GroupType::params_type>::value>::type> {
+                        typedef subgroup_check_methods::psi_endomorphism type;
+                    };
+
+                    template<typename GroupValueType>
+                    bool subgroup_check(const GroupValueType &p, subgroup_check_methods::scalar_mul) {
+                        return (p * GroupValueType::group_type::curve_type::scalar_field_type::modulus).is_zero();
+                    }
+
+                    /// Compares the image of p under the endomorphism with p times its eigenvalue, half or a third
+                    /// of the length of the subgroup order
+                    template<typename GroupValueType>
+                    bool endomorphism_check(const GroupValueType &p, const GroupValueType &image) {
+                        using params_type = typename GroupValueType::group_type::params_type;
+
+                        const GroupValueType multiple = p * params_type::endomorphism_eigenvalue;
+                        return params_type::is_endomorphism_eigenvalue_neg ? image == -multiple : image == multiple;
+                    }
+
+                    template<typename GroupValueType>
+                    bool subgroup_check(const GroupValueType &p, subgroup_check_methods::sigma_endomorphism) {
+                        using params_type = typename GroupValueType::group_type::params_type;
+
+                        // x is scaled in all the coordinate systems
+                        GroupValueType image = p;
+                        image.X = image.X * params_type::cube_root_of_unity;
+                        return endomorphism_check(p, image);
+                    }
+
+                    template<typename GroupValueType>
+                    bool subgroup_check(const GroupValueType &p, subgroup_check_methods::psi_endomorphism) {
+                        return endomorphism_check(p, psi(p));
+                    }
+
                     // TODO: temporary implementation due to absence of GroupValueType type_trait
                     //  Should be implemented as class method
+                    /// Checks that p is in the subgroup of order the scalar field modulus, with the method of
+                    /// subgroup_check_method: endomorphism criteria where the curve params provide them
                     template<typename GroupValueType, typename = typename std::enable_if<
                                                           is_curve_group<typename GroupValueType::group_type>::value &&
                                                           !is_field<typename GroupValueType::group_type>::value>::type>
                     bool subgroup_check(const GroupValueType &p) {
-                        return (p * GroupValueType::group_type::curve_type::q).is_zero();
+                        if (p.is_zero()) {
+                            return true;
+                        }
+                        return subgroup_check(
+                            p, typename subgroup_check_method<typename GroupValueType::group_type>::type());
                     }
                 }    // namespace detail
             }        // namespace curves
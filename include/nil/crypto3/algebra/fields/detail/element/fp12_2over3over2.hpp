@@ -190,6 +190,37 @@ namespace nil {
                             return element_fp12_2over3over2(data[0], -data[1]);
                         }
 
+                        /** @brief T2 torus compression of an element of norm one over Fp6, e.g. of GT:
+                         *  this = (c + w) / (c - w) with c = (1 + data[0]) / data[1], half the size of this.
+                         *  Returns false for this = 1, the only such element with no c.
+                         */
+                        bool torus_compress(underlying_type &c) const {
+                            if (data[1].is_zero()) {
+                                // norm one in Fp6 leaves this = 1 or this = -1, and c = 0 gives -1
+                                if (data[0] == underlying_type::one()) {
+                                    return false;
+                                }
+                                c = underlying_type::zero();
+                                return true;
+                            }
+
+                            c = (underlying_type::one() + data[0]) * data[1].inversed();
+                            return true;
+                        }
+
+                        /** @brief Inverse of torus_compress: (c + w) / (c - w) = (c^2 + v + 2cw) / (c^2 - v).
+                         *  c^2 - v never vanishes, v is not a square in Fp6.
+                         */
+                        static element_fp12_2over3over2 torus_decompress(const underlying_type &c) {
+                            const underlying_type v(underlying_type::underlying_type::zero(),
+                                                    underlying_type::underlying_type::one(),
+                                                    underlying_type::underlying_type::zero());
+                            const underlying_type c2 = c.squared();
+                            const underlying_type denominator_inv = (c2 - v).inversed();
+
+                            return element_fp12_2over3over2((c2 + v) * denominator_inv, (c + c) * denominator_inv);
+                        }
+
                         element_fp12_2over3over2 cyclotomic_squared() const {
                             // naive implementation
                             // return this->squared();
@@ -322,6 +353,42 @@ namespace nil {
                             return element_fp12_2over3over2(underlying_type(t0, t1, t2), underlying_type(t3, t4, t5));
                         }
 
+                        /** @brief Sparse multiplication by a line normalized so that slot 0 is a base field element,
+                         *  as produced by the affine precomputation of M-type twists: 6 Fp*Fp2 products replace
+                         *  the 6 Fp2*Fp2 products of slot 0.
+                         */
+                        element_fp12_2over3over2
+                            mul_by_045(const typename underlying_type::underlying_type &ell_0,
+                                       const typename underlying_type::underlying_type::underlying_type &ell_VW,
+                                       const typename underlying_type::underlying_type &ell_VV) const {
+
+                            typename underlying_type::underlying_type z0 = this->data[0].data[0];
+                            typename underlying_type::underlying_type z1 = this->data[0].data[1];
+                            typename underlying_type::underlying_type z2 = this->data[0].data[2];
+                            typename underlying_type::underlying_type z3 = this->data[1].data[0];
+                            typename underlying_type::underlying_type z4 = this->data[1].data[1];
+                            typename underlying_type::underlying_type z5 = this->data[1].data[2];
+
+                            const typename underlying_type::underlying_type::underlying_type &x0 = ell_VW;
+                            const typename underlying_type::underlying_type &x4 = ell_0;
+                            const typename underlying_type::underlying_type &x5 = ell_VV;
+
+                            typename underlying_type::underlying_type t0, t1, t2, t3, t4, t5;
+                            typename underlying_type::underlying_type tmp1, tmp2;
+
+                            tmp1 = element_fp12_2over3over2().non_residue * x4;
+                            tmp2 = element_fp12_2over3over2().non_residue * x5;
+
+                            t0 = x0 * z0 + tmp1 * z4 + tmp2 * z3;
+                            t1 = x0 * z1 + tmp1 * z5 + tmp2 * z4;
+                            t2 = x0 * z2 + x4 * z3 + tmp2 * z5;
+                            t3 = x0 * z3 + tmp1 * z2 + tmp2 * z1;
+                            t4 = x0 * z4 + x4 * z0 + tmp2 * z2;
+                            t5 = x0 * z5 + x4 * z1 + x5 * z0;
+
+                            return element_fp12_2over3over2(underlying_type(t0, t1, t2), underlying_type(t3, t4, t5));
+                        }
+
                         element_fp12_2over3over2
                             mul_by_024(const typename underlying_type::underlying_type &ell_0,
                                        const typename underlying_type::underlying_type &ell_VW,
@@ -334,6 +401,159 @@ namespace nil {
                             return (*this) * a;
                         }
 
+                        /** @brief Sparse multiplication by a line normalized so that slot 4 is a base field element,
+                         *  as produced by the affine precomputation of D-type twists.
+                         *  (A + B*w) * (C + D*w) with C = ell_0 + ell_VV*v^2 and D = ell_VW*v.
+                         */
+                        element_fp12_2over3over2
+                            mul_by_024(const typename underlying_type::underlying_type &ell_0,
+                                       const typename underlying_type::underlying_type::underlying_type &ell_VW,
+                                       const typename underlying_type::underlying_type &ell_VV) const {
+
+                            const typename underlying_type::underlying_type &a0 = this->data[0].data[0];
+                            const typename underlying_type::underlying_type &a1 = this->data[0].data[1];
+                            const typename underlying_type::underlying_type &a2 = this->data[0].data[2];
+                            const typename underlying_type::underlying_type &b0 = this->data[1].data[0];
+                            const typename underlying_type::underlying_type &b1 = this->data[1].data[1];
+                            const typename underlying_type::underlying_type &b2 = this->data[1].data[2];
+
+                            const typename underlying_type::underlying_type xi_ell_VV =
+                                element_fp12_2over3over2().non_residue * ell_VV;
+
+                            // A * C and B * C, C = ell_0 + ell_VV * v^2
+                            const underlying_type AC(a0 * ell_0 + xi_ell_VV * a1, a1 * ell_0 + xi_ell_VV * a2,
+                                                     a2 * ell_0 + a0 * ell_VV);
+                            const underlying_type BC(b0 * ell_0 + xi_ell_VV * b1, b1 * ell_0 + xi_ell_VV * b2,
+                                                     b2 * ell_0 + b0 * ell_VV);
+
+                            // A * D = ell_VW * A * v, B * D * v = ell_VW * B * v^2
+                            const typename underlying_type::underlying_type xi_a2 =
+                                element_fp12_2over3over2().non_residue * a2;
+                            const typename underlying_type::underlying_type xi_b1 =
+                                element_fp12_2over3over2().non_residue * b1;
+                            const typename underlying_type::underlying_type xi_b2 =
+                                element_fp12_2over3over2().non_residue * b2;
+
+                            return element_fp12_2over3over2(
+                                underlying_type(AC.data[0] + ell_VW * xi_b1, AC.data[1] + ell_VW * xi_b2,
+                                                AC.data[2] + ell_VW * b0),
+                                underlying_type(BC.data[0] + ell_VW * xi_a2, BC.data[1] + ell_VW * a0,
+                                                BC.data[2] + ell_VW * a1));
+                        }
+
+                        /** @brief Product of two lines in mul_by_045 form (slots 0, 4 and 5), so that a doubling and
+                         *  an addition line cost one multiplication into f instead of two. Karatsuba on the three
+                         *  pairwise products: 6 Fp2 multiplications, slot 3 of the result is zero.
+                         */
+                        static element_fp12_2over3over2
+                            mul_045_by_045(const typename underlying_type::underlying_type &ell_0_1,
+                                           const typename underlying_type::underlying_type &ell_VW_1,
+                                           const typename underlying_type::underlying_type &ell_VV_1,
+                                           const typename underlying_type::underlying_type &ell_0_2,
+                                           const typename underlying_type::underlying_type &ell_VW_2,
+                                           const typename underlying_type::underlying_type &ell_VV_2) {
+
+                            const typename underlying_type::underlying_type &x0 = ell_VW_1, &x4 = ell_0_1,
+                                                                            &x5 = ell_VV_1;
+                            const typename underlying_type::underlying_type &y0 = ell_VW_2, &y4 = ell_0_2,
+                                                                            &y5 = ell_VV_2;
+
+                            const typename underlying_type::underlying_type x0y0 = x0 * y0;
+                            const typename underlying_type::underlying_type x4y4 = x4 * y4;
+                            const typename underlying_type::underlying_type x5y5 = x5 * y5;
+
+                            const typename underlying_type::underlying_type t0 =
+                                x0y0 + element_fp12_2over3over2().non_residue * x4y4;
+                            const typename underlying_type::underlying_type t1 =
+                                element_fp12_2over3over2().non_residue * ((x4 + x5) * (y4 + y5) - x4y4 - x5y5);
+                            const typename underlying_type::underlying_type t2 =
+                                element_fp12_2over3over2().non_residue * x5y5;
+                            const typename underlying_type::underlying_type t4 = (x0 + x4) * (y0 + y4) - x0y0 - x4y4;
+                            const typename underlying_type::underlying_type t5 = (x0 + x5) * (y0 + y5) - x0y0 - x5y5;
+
+                            return element_fp12_2over3over2(
+                                underlying_type(t0, t1, t2),
+                                underlying_type(underlying_type::underlying_type::zero(), t4, t5));
+                        }
+
+                        /** @brief Product of two lines in mul_by_024 form (slots 0, 2 and 4), the D-type counterpart
+                         *  of mul_045_by_045: 6 Fp2 multiplications, slot 5 of the result is zero.
+                         */
+                        static element_fp12_2over3over2
+                            mul_024_by_024(const typename underlying_type::underlying_type &ell_0_1,
+                                           const typename underlying_type::underlying_type &ell_VW_1,
+                                           const typename underlying_type::underlying_type &ell_VV_1,
+                                           const typename underlying_type::underlying_type &ell_0_2,
+                                           const typename underlying_type::underlying_type &ell_VW_2,
+                                           const typename underlying_type::underlying_type &ell_VV_2) {
+
+                            const typename underlying_type::underlying_type &x0 = ell_0_1, &x2 = ell_VV_1,
+                                                                            &x4 = ell_VW_1;
+                            const typename underlying_type::underlying_type &y0 = ell_0_2, &y2 = ell_VV_2,
+                                                                            &y4 = ell_VW_2;
+
+                            const typename underlying_type::underlying_type x0y0 = x0 * y0;
+                            const typename underlying_type::underlying_type x2y2 = x2 * y2;
+                            const typename underlying_type::underlying_type x4y4 = x4 * y4;
+
+                            const typename underlying_type::underlying_type t0 =
+                                x0y0 + element_fp12_2over3over2().non_residue * x4y4;
+                            const typename underlying_type::underlying_type t1 =
+                                element_fp12_2over3over2().non_residue * x2y2;
+                            const typename underlying_type::underlying_type t2 = (x0 + x2) * (y0 + y2) - x0y0 - x2y2;
+                            const typename underlying_type::underlying_type t3 =
+                                element_fp12_2over3over2().non_residue * ((x2 + x4) * (y2 + y4) - x2y2 - x4y4);
+                            const typename underlying_type::underlying_type t4 = (x0 + x4) * (y0 + y4) - x0y0 - x4y4;
+
+                            return element_fp12_2over3over2(
+                                underlying_type(t0, t1, t2),
+                                underlying_type(t3, t4, underlying_type::underlying_type::zero()));
+                        }
+
+                        /** @brief Multiplication by an element with slot 3 zero, such as the product of two lines
+                         *  returned by mul_045_by_045. Karatsuba over Fp6 with the sparse B * D:
+                         *  17 Fp2 multiplications instead of 18.
+                         */
+                        element_fp12_2over3over2 mul_by_01245(const element_fp12_2over3over2 &other) const {
+                            using fp2_value_type = typename underlying_type::underlying_type;
+
+                            const underlying_type &A = this->data[0], &B = this->data[1];
+                            const underlying_type &C = other.data[0], &D = other.data[1];
+                            const fp2_value_type &d1 = D.data[1], &d2 = D.data[2];
+
+                            // B * D, D = d1 * v + d2 * v^2
+                            const fp2_value_type b1d1 = B.data[1] * d1;
+                            const fp2_value_type b2d2 = B.data[2] * d2;
+                            const underlying_type BD(
+                                non_residue * ((B.data[1] + B.data[2]) * (d1 + d2) - b1d1 - b2d2),
+                                B.data[0] * d1 + non_residue * b2d2,
+                                B.data[0] * d2 + b1d1);
+
+                            const underlying_type AC = A * C;
+                            return element_fp12_2over3over2(AC + mul_by_non_residue(BD), (A + B) * (C + D) - AC - BD);
+                        }
+
+                        /** @brief Multiplication by an element with slot 5 zero, such as the product of two lines
+                         *  returned by mul_024_by_024: 17 Fp2 multiplications instead of 18.
+                         */
+                        element_fp12_2over3over2 mul_by_01234(const element_fp12_2over3over2 &other) const {
+                            using fp2_value_type = typename underlying_type::underlying_type;
+
+                            const underlying_type &A = this->data[0], &B = this->data[1];
+                            const underlying_type &C = other.data[0], &D = other.data[1];
+                            const fp2_value_type &d0 = D.data[0], &d1 = D.data[1];
+
+                            // B * D, D = d0 + d1 * v
+                            const fp2_value_type b0d0 = B.data[0] * d0;
+                            const fp2_value_type b1d1 = B.data[1] * d1;
+                            const underlying_type BD(b0d0 + non_residue * (B.data[2] * d1),
+                                                     (B.data[0] + B.data[1]) * (d0 + d1) - b0d0 - b1d1,
+                                                     b1d1 + B.data[2] * d0);
+
+                            const underlying_type AC = A * C;
+                            return element_fp12_2over3over2(AC + mul_by_non_residue(BD), (A + B) * (C + D) - AC - BD);
+                        }
+
                         /*element_fp12_2over3over2 sqru() {
                             element_fp2<FieldParams> &z0(a_.a_);
                             element_fp2<FieldParams> &z4(a_.b_);
@@ -148,16 +148,7 @@ namespace nil {
                         }
 
                         constexpr element_fp3& operator*=(const element_fp3 &B) {
-                            const underlying_type A0B0 = data[0] * B.data[0], A1B1 = data[1] * B.data[1],
-                                                  A2B2 = data[2] * B.data[2];
-                            const underlying_type
-                                r0 = A0B0 + non_residue * ((data[1] + data[2]) * (B.data[1] + B.data[2]) - A1B1 - A2B2),
-                                r1 = (data[0] + data[1]) * (B.data[0] + B.data[1]) - A0B0 - A1B1 + non_residue * A2B2,
-                                r2 = (data[0] + data[2]) * (B.data[0] + B.data[2]) - A0B0 + A1B1 - A2B2;
-
-                            data[0] = r0;
-                            data[1] = r1;
-                            data[2] = r2;
+                            *this = *this * B;
                             return *this;
                         }
 
@@ -197,7 +188,17 @@ namespace nil {
                         }
 
                         constexpr element_fp3 squared() const {
-                            return (*this) * (*this);    // maybe can be done more effective
+                            /* Chung, Hasan --- Asymmetric Squaring Formulae; SQR2: 2 multiplications and 3 squarings
+                             * instead of the 6 multiplications of the Karatsuba product */
+                            const underlying_type &A0 = data[0], &A1 = data[1], &A2 = data[2];
+
+                            const underlying_type s0 = A0.squared();
+                            const underlying_type s1 = (A0 * A1).doubled();
+                            const underlying_type s2 = (A0 - A1 + A2).squared();
+                            const underlying_type s3 = (A1 * A2).doubled();
+                            const underlying_type s4 = A2.squared();
+
+                            return element_fp3(s0 + non_residue * s3, s1 + non_residue * s4, s1 + s2 + s3 - s0 - s4);
                         }
 
                         constexpr bool is_square() const {
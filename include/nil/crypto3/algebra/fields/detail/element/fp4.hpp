@@ -145,7 +145,13 @@ namespace nil {
                         }
 
                         constexpr element_fp4 squared() const {
-                            return (*this) * (*this);    // maybe can be done more effective
+                            /* Devegili OhEig Scott Dahab --- Multiplication and Squaring on Pairing-Friendly
+                             * Fields.pdf; Section 3 (Complex) */
+                            const underlying_type &B = data[1], &A = data[0];
+                            const underlying_type AB = A * B;
+
+                            return element_fp4((A + B) * (A + mul_by_non_residue(B)) - AB - mul_by_non_residue(AB),
+                                               AB + AB);
                         }
 
                         template<typename PowerType>
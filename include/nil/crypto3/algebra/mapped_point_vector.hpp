@@ -0,0 +1,485 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_MAPPED_POINT_VECTOR_HPP
+#define CRYPTO3_ALGEBRA_MAPPED_POINT_VECTOR_HPP
+
+#include <nil/crypto3/algebra/marshalling.hpp>
+#include <nil/crypto3/algebra/type_traits.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                /// Word-wise FNV-1a style hash, fast enough to checksum multi-gigabyte point files.
+                inline std::uint64_t point_vector_checksum(const unsigned char *data, std::size_t size,
+                                                           std::uint64_t seed) {
+                    constexpr const std::uint64_t prime = 0x100000001B3ull;
+
+                    std::uint64_t result = seed;
+                    std::size_t i = 0;
+                    for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+                        std::uint64_t word;
+                        std::memcpy(&word, data + i, sizeof(word));
+                        result = (result ^ word) * prime;
+                        result ^= result >> 29;
+                    }
+                    for (; i < size; ++i) {
+                        result = (result ^ data[i]) * prime;
+                    }
+                    return result;
+                }
+
+                /// Copies the Montgomery limbs of a field element to and from a fixed-width limb array. An
+                /// extension field element is the limbs of its coefficients, lowest first.
+                template<typename FieldType, bool = is_extended_field<FieldType>::value>
+                struct field_limbs;
+
+                template<typename FieldType>
+                struct field_limbs<FieldType, false> {
+                    using value_type = typename FieldType::value_type;
+                    using backend_type = typename std::decay<decltype(
+                        std::declval<const value_type &>().data.backend().base_data())>::type;
+                    using limb_type = typename backend_type::limb_type;
+
+                    constexpr static const std::size_t limbs_count = backend_type::internal_limb_count;
+
+                    static_assert(FieldType::integral_type::backend_type::internal_limb_count == limbs_count,
+                                  "the modulus is compared limb by limb");
+
+                    static void store(const value_type &element, limb_type *limbs) {
+                        std::memcpy(limbs, element.data.backend().base_data().limbs(),
+                                    limbs_count * sizeof(limb_type));
+                    }
+
+                    static void load(const limb_type *limbs, value_type &element) {
+                        std::memcpy(element.data.backend().base_data().limbs(), limbs,
+                                    limbs_count * sizeof(limb_type));
+                    }
+
+                    /// A Montgomery representation is reduced, as the one of a field element is.
+                    static bool is_reduced(const limb_type *limbs) {
+                        const limb_type *modulus = FieldType::modulus.backend().limbs();
+                        for (std::size_t i = limbs_count; i-- > 0;) {
+                            if (limbs[i] != modulus[i]) {
+                                return limbs[i] < modulus[i];
+                            }
+                        }
+                        return false;
+                    }
+                };
+
+                template<typename FieldType>
+                struct field_limbs<FieldType, true> {
+                    using value_type = typename FieldType::value_type;
+                    using underlying_type = field_limbs<typename FieldType::extension_policy::underlying_field_type>;
+                    using limb_type = typename underlying_type::limb_type;
+
+                    constexpr static const std::size_t coefficients_count =
+                        std::tuple_size<typename value_type::data_type>::value;
+                    constexpr static const std::size_t limbs_count =
+                        coefficients_count * underlying_type::limbs_count;
+
+                    static void store(const value_type &element, limb_type *limbs) {
+                        for (std::size_t i = 0; i < coefficients_count; ++i) {
+                            underlying_type::store(element.data[i], limbs + i * underlying_type::limbs_count);
+                        }
+                    }
+
+                    static void load(const limb_type *limbs, value_type &element) {
+                        for (std::size_t i = 0; i < coefficients_count; ++i) {
+                            underlying_type::load(limbs + i * underlying_type::limbs_count, element.data[i]);
+                        }
+                    }
+
+                    static bool is_reduced(const limb_type *limbs) {
+                        for (std::size_t i = 0; i < coefficients_count; ++i) {
+                            if (!underlying_type::is_reduced(limbs + i * underlying_type::limbs_count)) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    }
+                };
+            }    // namespace detail
+
+            /** @brief Read-only vector of affine short Weierstrass points backed by a memory-mapped file,
+             *  e.g. the powers of tau of an SRS. Points are stored in place as fixed-width records of
+             *  Montgomery limbs, so opening a file does no parsing and accessing a point only copies its
+             *  limbs out of the mapping, without any conversion.
+             *
+             *  File layout: a 64-byte header, then count records of element_size bytes each. A record is
+             *  the limbs of X then the limbs of Y, as laid out by detail::field_limbs. The header holds a
+             *  magic, the format version, the record size, the limb size, a byte order mark, a group id,
+             *  the count and a checksum of the records, all in the machine's byte order: files written on
+             *  a machine with another limb size or byte order are rejected on open. The group id is a hash
+             *  of the generator's record, so that files written for another group, field or Montgomery
+             *  representation are rejected as well.
+             *
+             *  @tparam GroupType affine group type, e.g. curves::bls12<381>::g1_type<curves::coordinates::affine>
+             */
+            template<typename GroupType>
+            class mapped_point_vector {
+                using field_type = typename GroupType::field_type;
+                using field_limbs = detail::field_limbs<field_type>;
+
+            public:
+                using group_type = GroupType;
+                using value_type = typename group_type::value_type;
+                using limb_type = typename field_limbs::limb_type;
+
+                /// A point as stored in the file.
+                struct record_type {
+                    std::array<limb_type, 2 * field_limbs::limbs_count> limbs;
+                };
+                static_assert(std::is_trivially_copyable<record_type>::value &&
+                                  std::has_unique_object_representations<record_type>::value,
+                              "records are read in place and hashed as octets, they must have no padding");
+
+                constexpr static const std::size_t header_size = 64;
+                constexpr static const std::size_t element_size = sizeof(record_type);
+                static_assert(alignof(record_type) <= header_size, "records must stay aligned after the header");
+
+                constexpr static const std::uint32_t version = 3;
+
+                /// Random access over the records, a point is decoded from its record on dereference.
+                class const_iterator {
+                public:
+                    using iterator_category = std::random_access_iterator_tag;
+                    using value_type = typename mapped_point_vector::value_type;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = const value_type *;
+                    using reference = value_type;
+
+                    const_iterator() = default;
+
+                    explicit const_iterator(const record_type *record) : record(record) {
+                    }
+
+                    value_type operator*() const {
+                        return decode(*record);
+                    }
+
+                    value_type operator[](difference_type n) const {
+                        return decode(record[n]);
+                    }
+
+                    const_iterator &operator++() {
+                        ++record;
+                        return *this;
+                    }
+
+                    const_iterator operator++(int) {
+                        const_iterator result = *this;
+                        ++record;
+                        return result;
+                    }
+
+                    const_iterator &operator--() {
+                        --record;
+                        return *this;
+                    }
+
+                    const_iterator operator--(int) {
+                        const_iterator result = *this;
+                        --record;
+                        return result;
+                    }
+
+                    const_iterator &operator+=(difference_type n) {
+                        record += n;
+                        return *this;
+                    }
+
+                    const_iterator &operator-=(difference_type n) {
+                        record -= n;
+                        return *this;
+                    }
+
+                    const_iterator operator+(difference_type n) const {
+                        return const_iterator(record + n);
+                    }
+
+                    friend const_iterator operator+(difference_type n, const const_iterator &it) {
+                        return it + n;
+                    }
+
+                    const_iterator operator-(difference_type n) const {
+                        return const_iterator(record - n);
+                    }
+
+                    difference_type operator-(const const_iterator &other) const {
+                        return record - other.record;
+                    }
+
+                    bool operator==(const const_iterator &other) const {
+                        return record == other.record;
+                    }
+
+                    bool operator!=(const const_iterator &other) const {
+                        return record != other.record;
+                    }
+
+                    bool operator<(const const_iterator &other) const {
+                        return record < other.record;
+                    }
+
+                    bool operator>(const const_iterator &other) const {
+                        return record > other.record;
+                    }
+
+                    bool operator<=(const const_iterator &other) const {
+                        return record <= other.record;
+                    }
+
+                    bool operator>=(const const_iterator &other) const {
+                        return record >= other.record;
+                    }
+
+                private:
+                    const record_type *record = nullptr;
+                };
+
+                mapped_point_vector() = default;
+
+                /// Maps the file at path, returns false if it can not be mapped or its header does not match
+                /// value_type. Either the checksum is verified, or every record is checked to be reduced and
+                /// on the curve: both read the whole file.
+                bool open(const std::string &path, bool verify_checksum = false) {
+                    close();
+
+                    try {
+                        file = boost::interprocess::file_mapping(path.c_str(), boost::interprocess::read_only);
+                        region = boost::interprocess::mapped_region(file, boost::interprocess::read_only);
+                    } catch (const boost::interprocess::interprocess_exception &) {
+                        close();
+                        return false;
+                    }
+
+                    if (region.get_size() < header_size) {
+                        close();
+                        return false;
+                    }
+
+                    const unsigned char *base = static_cast<const unsigned char *>(region.get_address());
+                    header_type header;
+                    std::memcpy(&header, base, sizeof(header));
+
+                    if (header.magic != magic() || header.version != version ||
+                        header.element_size != element_size || header.limb_size != sizeof(limb_type) ||
+                        header.byte_order != byte_order_mark || header.group_id != group_id() ||
+                        header.count > (region.get_size() - header_size) / element_size) {
+                        close();
+                        return false;
+                    }
+
+                    records = reinterpret_cast<const record_type *>(base + header_size);
+                    points_count = header.count;
+
+                    const bool valid = verify_checksum ? checksum(records, points_count) == header.checksum :
+                                                         are_valid(records, points_count);
+                    if (!valid) {
+                        close();
+                        return false;
+                    }
+                    return true;
+                }
+
+                void close() {
+                    region = boost::interprocess::mapped_region();
+                    file = boost::interprocess::file_mapping();
+                    records = nullptr;
+                    points_count = 0;
+                }
+
+                std::size_t size() const {
+                    return points_count;
+                }
+
+                bool empty() const {
+                    return points_count == 0;
+                }
+
+                /// The records in place in the mapping.
+                const record_type *data() const {
+                    return records;
+                }
+
+                const_iterator begin() const {
+                    return const_iterator(records);
+                }
+
+                const_iterator end() const {
+                    return const_iterator(records + points_count);
+                }
+
+                value_type operator[](std::size_t i) const {
+                    return decode(records[i]);
+                }
+
+                /// Decodes the count points from first to out, e.g. to fill a buffer for a multiexponentiation.
+                template<typename OutputIterator>
+                OutputIterator decode(std::size_t first, std::size_t count, OutputIterator out) const {
+                    BOOST_ASSERT(first + count <= points_count);
+
+                    for (const record_type *record = records + first; record != records + first + count; ++record) {
+                        *out++ = decode(*record);
+                    }
+                    return out;
+                }
+
+                /// Writes the points of [first, last) to path in the format open() maps.
+                template<typename InputIterator>
+                static bool write(const std::string &path, InputIterator first, InputIterator last) {
+                    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+                    if (!out) {
+                        return false;
+                    }
+
+                    header_type header = {};
+                    header.magic = magic();
+                    header.version = version;
+                    header.element_size = element_size;
+                    header.limb_size = sizeof(limb_type);
+                    header.byte_order = byte_order_mark;
+                    header.group_id = group_id();
+                    header.checksum = checksum_seed;
+
+                    // the header is rewritten once the count and checksum are known
+                    std::array<char, header_size> header_octets = {};
+                    out.write(header_octets.data(), header_octets.size());
+
+                    for (; first != last; ++first, ++header.count) {
+                        const record_type record = encode(*first);
+                        header.checksum = checksum(&record, 1, header.checksum);
+                        out.write(reinterpret_cast<const char *>(&record), sizeof(record));
+                    }
+
+                    std::memcpy(header_octets.data(), &header, sizeof(header));
+                    out.seekp(0);
+                    out.write(header_octets.data(), header_octets.size());
+
+                    return bool(out);
+                }
+
+            private:
+                struct header_type {
+                    std::uint64_t magic;
+                    std::uint32_t version;
+                    std::uint32_t element_size;
+                    std::uint32_t limb_size;
+                    std::uint32_t byte_order;
+                    std::uint64_t group_id;
+                    std::uint64_t count;
+                    std::uint64_t checksum;
+                };
+                static_assert(sizeof(header_type) <= header_size, "header must fit its reserved space");
+                static_assert(std::is_trivially_copyable<header_type>::value &&
+                                  std::has_unique_object_representations<header_type>::value,
+                              "the header is copied as octets, it must have no padding");
+
+                /// "NILPOINT" read as a little-endian word.
+                constexpr static std::uint64_t magic() {
+                    return 0x544E494F504C494Eull;
+                }
+
+                /// Reads back as another value on a machine of the other byte order.
+                constexpr static const std::uint32_t byte_order_mark = 0x01020304;
+
+                constexpr static const std::uint64_t checksum_seed = 0xCBF29CE484222325ull;
+
+                static record_type encode(const value_type &point) {
+                    record_type record;
+                    field_limbs::store(point.X, record.limbs.data());
+                    field_limbs::store(point.Y, record.limbs.data() + field_limbs::limbs_count);
+                    return record;
+                }
+
+                static value_type decode(const record_type &record) {
+                    value_type point;
+                    field_limbs::load(record.limbs.data(), point.X);
+                    field_limbs::load(record.limbs.data() + field_limbs::limbs_count, point.Y);
+                    return point;
+                }
+
+                /// Records are hashed one after another, so that write() needs no buffer.
+                static std::uint64_t checksum(const record_type *first, std::size_t count,
+                                              std::uint64_t seed = checksum_seed) {
+                    for (std::size_t i = 0; i < count; ++i) {
+                        seed = detail::point_vector_checksum(reinterpret_cast<const unsigned char *>(first + i),
+                                                             element_size, seed);
+                    }
+                    return seed;
+                }
+
+                /// Without a checksum the records are untrusted: a coordinate that is not reduced would break
+                /// the field arithmetic, and a point off the curve the group law.
+                static bool are_valid(const record_type *first, std::size_t count) {
+                    return nil::marshalling::detail::parallel_chunks(
+                        count, std::thread::hardware_concurrency(), [first](std::size_t begin, std::size_t end) {
+                            for (std::size_t i = begin; i < end; ++i) {
+                                const limb_type *limbs = first[i].limbs.data();
+                                if (!field_limbs::is_reduced(limbs) ||
+                                    !field_limbs::is_reduced(limbs + field_limbs::limbs_count) ||
+                                    !decode(first[i]).to_projective().is_well_formed()) {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        });
+                }
+
+                static std::uint64_t group_id() {
+                    const record_type generator = encode(value_type::one());
+                    return detail::point_vector_checksum(reinterpret_cast<const unsigned char *>(&generator),
+                                                         element_size, element_size);
+                }
+
+                boost::interprocess::file_mapping file;
+                boost::interprocess::mapped_region region;
+                const record_type *records = nullptr;
+                std::size_t points_count = 0;
+            };
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_MAPPED_POINT_VECTOR_HPP
@@ -219,7 +219,7 @@ namespace nil {
                 template<typename InputG1Iterator>
                 static inline typename std::enable_if<
                     std::is_same<chunk_type, typename std::iterator_traits<InputG1Iterator>::value_type>::value,
-                    typename g1_type::value_type>::type
+                    std::pair<bool, typename g1_type::value_type>>::type
                     g1_point_from_bytes(InputG1Iterator first, InputG1Iterator last) {
                     BOOST_ASSERT(g1_octets_num == std::distance(first, last));
 
@@ -230,13 +230,15 @@ namespace nil {
                         *it2++ = *it1++;
                     }
 
-                    return curve_element_serializer<curve_type>::octets_to_g1_point(input_array);
+                    typename g1_type::value_type result;
+                    const bool is_valid = curve_element_serializer<curve_type>::octets_to_g1_point(input_array, result);
+                    return std::make_pair(is_valid, result);
                 }
 
                 template<typename InputG2Iterator>
                 static inline typename std::enable_if<
                     std::is_same<chunk_type, typename std::iterator_traits<InputG2Iterator>::value_type>::value,
-                    typename g2_type::value_type>::type
+                    std::pair<bool, typename g2_type::value_type>>::type
                     g2_point_from_bytes(InputG2Iterator first, InputG2Iterator last) {
                     BOOST_ASSERT(g2_octets_num == std::distance(first, last));
 
@@ -247,7 +249,9 @@ namespace nil {
                         *it2++ = *it1++;
                     }
 
-                    return curve_element_serializer<curve_type>::octets_to_g2_point(input_array);
+                    typename g2_type::value_type result;
+                    const bool is_valid = curve_element_serializer<curve_type>::octets_to_g2_point(input_array, result);
+                    return std::make_pair(is_valid, result);
                 }
 
                 template<typename FieldType, typename OutputIterator>
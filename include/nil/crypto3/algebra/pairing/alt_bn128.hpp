@@ -29,11 +29,15 @@
 #include <nil/crypto3/algebra/curves/babyjubjub.hpp>
 #include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/pairing/detail/alt_bn128/params.hpp>
+#include <nil/crypto3/algebra/pairing/alt_bn128/254/final_exponentiation.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/affine_ate_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/affine_ate_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_double_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_multi_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g1.hpp>
 #include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/ate_precompute_g2.hpp>
-#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/final_exponentiation.hpp>
+#include <nil/crypto3/algebra/pairing/forms/short_weierstrass/jacobian_with_a4_0/gt_exponentiation.hpp>
 #include <nil/crypto3/algebra/pairing/pairing_policy.hpp>
 
 namespace nil {
@@ -52,11 +56,20 @@ namespace nil {
                     using miller_loop = pairing::short_weierstrass_jacobian_with_a4_0_ate_miller_loop<curve_type>;
                     using double_miller_loop =
                         pairing::short_weierstrass_jacobian_with_a4_0_ate_double_miller_loop<curve_type>;
-                    using final_exponentiation =
-                        pairing::short_weierstrass_jacobian_with_a4_0_final_exponentiation<curve_type>;
+                    using multi_miller_loop =
+                        pairing::short_weierstrass_jacobian_with_a4_0_ate_multi_miller_loop<curve_type>;
+                    using final_exponentiation = pairing::alt_bn128_final_exponentiation<254>;
+                    using gt_exponentiation =
+                        pairing::short_weierstrass_jacobian_with_a4_0_gt_exponentiation<curve_type>;
+
+                    using affine_precompute_g2 =
+                        pairing::short_weierstrass_jacobian_with_a4_0_affine_ate_precompute_g2<curve_type>;
+                    using affine_miller_loop =
+                        pairing::short_weierstrass_jacobian_with_a4_0_affine_ate_miller_loop<curve_type>;
 
                     using g1_precomputed_type = typename precompute_g1::g1_precomputed_type;
                     using g2_precomputed_type = typename precompute_g2::g2_precomputed_type;
+                    using affine_g2_precomputed_type = typename affine_precompute_g2::g2_precomputed_type;
                 };
 
             }    // namespace pairing
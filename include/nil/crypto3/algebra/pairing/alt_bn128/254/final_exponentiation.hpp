@@ -0,0 +1,130 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_FINAL_EXPONENTIATION_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_FINAL_EXPONENTIATION_HPP
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/pairing/detail/alt_bn128/params.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                template<std::size_t Version = 254>
+                class alt_bn128_final_exponentiation;
+
+                /** @brief Final exponentiation f^((p^12-1)/r) for BN254.
+                 *
+                 *  The hard part (p^4-p^2+1)/r is computed exactly, so the result matches
+                 *  f.pow(params_type::final_exponent). It uses the vectorial addition chain of Scott et al.,
+                 *  "On the final exponentiation for calculating pairings on ordinary elliptic curves":
+                 *  three cyclotomic exponentiations by z and Frobenius maps, with no multiple of the exponent.
+                 */
+                template<>
+                class alt_bn128_final_exponentiation<254> {
+                    using curve_type = curves::alt_bn128<254>;
+
+                    using params_type = detail::pairing_params<curve_type>;
+
+                    using gt_type = typename curve_type::gt_type;
+
+                    static typename gt_type::value_type
+                        final_exponentiation_first_chunk(const typename gt_type::value_type &elt) {
+
+                        /* elt^((q^6-1)*(q^2+1)) = (conj(elt) * elt^(-1))^(q^2+1) */
+                        const typename gt_type::value_type A = elt.unitary_inversed();
+                        const typename gt_type::value_type B = elt.inversed();
+                        const typename gt_type::value_type C = A * B;
+                        const typename gt_type::value_type D = C.Frobenius_map(2);
+                        const typename gt_type::value_type result = D * C;
+
+                        return result;
+                    }
+
+                    static typename gt_type::value_type exp_by_z(const typename gt_type::value_type &elt) {
+
+                        typename gt_type::value_type result = elt.cyclotomic_exp(params_type::final_exponent_z);
+                        if (params_type::final_exponent_is_z_neg) {
+                            result = result.unitary_inversed();
+                        }
+
+                        return result;
+                    }
+
+                    static typename gt_type::value_type
+                        final_exponentiation_last_chunk(const typename gt_type::value_type &elt) {
+
+                        /*
+                          (q^4-q^2+1)/r = l3*q^3 + l2*q^2 + l1*q + l0 with
+                            l3 = 1, l2 = 6z^2+1, l1 = -36z^3-18z^2-12z+1, l0 = -36z^3-30z^2-18z-2,
+                          written as y0 * y1^2 * y2^6 * y3^12 * y4^18 * y5^30 * y6^36 where
+                            y0 = elt^(q+q^2+q^3), y1 = elt^(-1), y2 = elt^(z^2*q^2), y3 = elt^(-z*q),
+                            y4 = elt^(-z-z^2*q), y5 = elt^(-z^2), y6 = elt^(-z^3-z^3*q).
+                          Inversions are conjugations in the cyclotomic subgroup.
+                        */
+                        const typename gt_type::value_type elt_z = exp_by_z(elt);
+                        const typename gt_type::value_type elt_z2 = exp_by_z(elt_z);
+                        const typename gt_type::value_type elt_z3 = exp_by_z(elt_z2);
+
+                        const typename gt_type::value_type y0 =
+                            elt.Frobenius_map(1) * elt.Frobenius_map(2) * elt.Frobenius_map(3);
+                        const typename gt_type::value_type y1 = elt.unitary_inversed();
+                        const typename gt_type::value_type y2 = elt_z2.Frobenius_map(2);
+                        const typename gt_type::value_type y3 = elt_z.Frobenius_map(1).unitary_inversed();
+                        const typename gt_type::value_type y4 = (elt_z * elt_z2.Frobenius_map(1)).unitary_inversed();
+                        const typename gt_type::value_type y5 = elt_z2.unitary_inversed();
+                        const typename gt_type::value_type y6 = (elt_z3 * elt_z3.Frobenius_map(1)).unitary_inversed();
+
+                        typename gt_type::value_type T0 = y6.cyclotomic_squared() * y4 * y5;
+                        typename gt_type::value_type T1 = y3 * y5 * T0;
+                        T0 = T0 * y2;
+                        T1 = (T1.cyclotomic_squared() * T0).cyclotomic_squared();
+                        T0 = T1 * y1;
+                        T1 = T1 * y0;
+                        T0 = T0.cyclotomic_squared();
+
+                        return T0 * T1;
+                    }
+
+                public:
+                    static typename gt_type::value_type process(const typename gt_type::value_type &elt) {
+
+                        /* OLD naive version:
+                            typename gt_type::value_type result =
+                                elt^final_exponent;
+                        */
+                        typename gt_type::value_type A = final_exponentiation_first_chunk(elt);
+                        typename gt_type::value_type result = final_exponentiation_last_chunk(A);
+
+                        return result;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_ALT_BN128_254_FINAL_EXPONENTIATION_HPP
@@ -56,9 +56,45 @@ namespace nil {
                         constexpr static const integral_type final_exponent_z = integral_type(0x44E992B44A6909F1);
                         constexpr static const bool final_exponent_is_z_neg = false;
 
+                        using scalar_integral_type = typename curve_type::scalar_field_type::integral_type;
+
+                        /// Frobenius acts on GT as exponentiation by p = 6 * z^2 (mod r): GT exponents split into digits of this size.
+                        constexpr static const scalar_integral_type gt_frobenius_eigenvalue =
+                            scalar_integral_type(0x6F4D8248EEB859FBF83E9682E87CFD46_cppui_modular127);
+                        constexpr static const bool gt_is_frobenius_eigenvalue_neg = false;
+
                         using g2_field_type_value = typename curve_type::g2_type<>::field_type::value_type;
 
                         constexpr static const g2_field_type_value twist = curve_type::g2_type<>::params_type::twist;
+                        constexpr static const g2_field_type_value twist_coeff_b =
+                            curve_type::g2_type<>::params_type::b;
+
+                        /// D-type sextic twist: twist_coeff_b = b / twist.
+                        constexpr static const bool twist_is_d_type = true;
+                        /// Optimal ate for BN adds the lines through pi(Q) and -pi^2(Q) after the loop.
+                        constexpr static const bool ate_has_frobenius_lines = true;
+
+                        using base_field_value_type = typename curve_type::base_field_type::value_type;
+
+                        /// Constants of the Miller loop, so that precomputations do no inversions of their own.
+                        constexpr static const base_field_value_type two_inv = base_field_value_type(
+                            0x183227397098D014DC2822DB40C0AC2ECBC0B548B438E5469E10460B6C3E7EA4_cppui_modular253);
+                        /// 3 * twist_coeff_b, the only multiple of b the projective doubling step needs.
+                        constexpr static const g2_field_type_value three_twist_coeff_b = g2_field_type_value(
+                            g2_field_type_value::underlying_type(0x20753ADCA9C6BFB81499BE5E509E8F8FF21B7C8D3CB039CF1EF69C66BCE9B021_cppui_modular254),
+                            g2_field_type_value::underlying_type(0x1C53B10B0D2FC7E67860F09CC8AF9DDF5EEE18EAF8748F8ADE8371391494176_cppui_modular249));
+                        constexpr static const g2_field_type_value twist_inv = g2_field_type_value(
+                            g2_field_type_value::underlying_type(0x2E9F1362305EA3AB50CA36ACB4F65E7FA1928902B8EA81948E3855034733BBD1_cppui_modular254),
+                            g2_field_type_value::underlying_type(0x20753ADCA9C6BFB81499BE5E509E8F8FF21B7C8D3CB039CF1EF69C66BCE9B020_cppui_modular254));
+
+                        /// Frobenius endomorphism on the twist: pi(x, y) = (x^p * twist_mul_by_q_X, y^p * twist_mul_by_q_Y),
+                        /// twist_mul_by_q_X = twist^((p-1)/3), twist_mul_by_q_Y = twist^((p-1)/2).
+                        constexpr static const g2_field_type_value twist_mul_by_q_X = g2_field_type_value(
+                            0x2FB347984F7911F74C0BEC3CF559B143B78CC310C2C3330C99E39557176F553D_cppui_modular254,
+                            0x16C9E55061EBAE204BA4CC8BD75A079432AE2A1D0B7C9DCE1665D51C640FCBA2_cppui_modular253);
+                        constexpr static const g2_field_type_value twist_mul_by_q_Y = g2_field_type_value(
+                            0x63CF305489AF5DCDC5EC698B6E2F9B9DBAAE0EDA9C95998DC54014671A0135A_cppui_modular251,
+                            0x7C03CBCAC41049A0704B5A7EC796F2B21807DC98FA25BD282D37F632623B0E3_cppui_modular251);
                     };
 
                     constexpr typename pairing_params<curves::alt_bn128<254>>::integral_type const
@@ -66,12 +102,33 @@ namespace nil {
 
                     constexpr typename pairing_params<curves::alt_bn128<254>>::integral_type const
                         pairing_params<curves::alt_bn128<254>>::final_exponent_z;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::scalar_integral_type const
+                        pairing_params<curves::alt_bn128<254>>::gt_frobenius_eigenvalue;
 
                     constexpr typename pairing_params<curves::alt_bn128<254>>::extended_integral_type const
                         pairing_params<curves::alt_bn128<254>>::final_exponent;
 
                     constexpr bool const pairing_params<curves::alt_bn128<254>>::ate_is_loop_count_neg;
                     constexpr bool const pairing_params<curves::alt_bn128<254>>::final_exponent_is_z_neg;
+                    constexpr bool const pairing_params<curves::alt_bn128<254>>::gt_is_frobenius_eigenvalue_neg;
+                    constexpr bool const pairing_params<curves::alt_bn128<254>>::twist_is_d_type;
+                    constexpr bool const pairing_params<curves::alt_bn128<254>>::ate_has_frobenius_lines;
+
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist_coeff_b;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist_mul_by_q_X;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist_mul_by_q_Y;
+
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::base_field_value_type const
+                        pairing_params<curves::alt_bn128<254>>::two_inv;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::three_twist_coeff_b;
+                    constexpr typename pairing_params<curves::alt_bn128<254>>::g2_field_type_value const
+                        pairing_params<curves::alt_bn128<254>>::twist_inv;
 
                 }    // namespace detail
             }        // namespace pairing
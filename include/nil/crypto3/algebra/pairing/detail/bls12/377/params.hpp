@@ -26,8 +26,7 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_BLS12_377_BASIC_PARAMS_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_BLS12_377_BASIC_PARAMS_HPP
 
-#include <nil/crypto3/algebra/curves/detail/bls12/g1.hpp>
-#include <nil/crypto3/algebra/curves/detail/bls12/g2.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -49,8 +48,6 @@ namespace nil {
                         constexpr static const std::size_t integral_type_max_bits =
                             curve_type::base_field_type::modulus_bits;
 
-                        constexpr static const std::size_t integral_type_max_bits = base_field_bits;
-
                         constexpr static const integral_type ate_loop_count = integral_type(0x8508C00000000001_cppui_modular64);
                         constexpr static const bool ate_is_loop_count_neg = false;
                         // constexpr static const extended_integral_type final_exponent = extended_integral_type(
@@ -60,9 +57,47 @@ namespace nil {
                             integral_type(0x8508C00000000001_cppui_modular64);
                         constexpr static const bool final_exponent_is_z_neg = false;
 
-                        using g2_field_type_value = typename curve_type::g2_type::field_type::value_type;
-
-                        constexpr static const g2_field_type_value twist = g2_type::params_type::twist;
+                        using scalar_integral_type = typename curve_type::scalar_field_type::integral_type;
+
+                        /// Frobenius acts on GT as exponentiation by p = z (mod r): GT exponents split into digits of this size.
+                        constexpr static const scalar_integral_type gt_frobenius_eigenvalue =
+                            scalar_integral_type(0x8508C00000000001_cppui_modular64);
+                        constexpr static const bool gt_is_frobenius_eigenvalue_neg = false;
+
+                        using g2_field_type_value = typename curve_type::template g2_type<>::field_type::value_type;
+
+                        constexpr static const g2_field_type_value twist =
+                            curve_type::template g2_type<>::params_type::twist;
+
+                        constexpr static const g2_field_type_value twist_coeff_b =
+                            curve_type::template g2_type<>::params_type::b;
+
+                        /// D-type sextic twist: twist_coeff_b = b / twist.
+                        constexpr static const bool twist_is_d_type = true;
+                        /// Optimal ate for BLS12 needs no lines through Frobenius images of Q.
+                        constexpr static const bool ate_has_frobenius_lines = false;
+
+                        using base_field_value_type = typename curve_type::base_field_type::value_type;
+
+                        /// Constants of the Miller loop, so that precomputations do no inversions of their own.
+                        constexpr static const base_field_value_type two_inv = base_field_value_type(
+                            0xD71D230BE28875631D82E03650A49D8D116CF9807A89C78F79B117DD04A4000B85AEA2180000004284600000000001_cppui_modular376);
+                        /// 3 * twist_coeff_b, the only multiple of b the projective doubling step needs.
+                        constexpr static const g2_field_type_value three_twist_coeff_b = g2_field_type_value(
+                            g2_field_type_value::underlying_type::zero(),
+                            g2_field_type_value::underlying_type(0x1582E9E796A73EF04FC0499F08107627B4F14C2672A760C18C2B4F2FB3AA000126F7DD026666666D0D3CCCCCCCCCCCD_cppui_modular377));
+                        constexpr static const g2_field_type_value twist_inv = g2_field_type_value(
+                            g2_field_type_value::underlying_type::zero(),
+                            g2_field_type_value::underlying_type(0x10222F6DB0FD6F343BD03737460C589DC7B4F91CD5FD889129207B63C6BF8000DD39E5C1CCCCCCD1C9ED9999999999A_cppui_modular377));
+
+                        /// Frobenius endomorphism on the twist: psi(x, y) = (x^p * twist_mul_by_q_X, y^p * twist_mul_by_q_Y),
+                        /// twist_mul_by_q_X = twist^((p-1)/3), twist_mul_by_q_Y = twist^((p-1)/2).
+                        constexpr static const g2_field_type_value twist_mul_by_q_X = g2_field_type_value(
+                            g2_field_type_value::underlying_type(0x9B3AF05DD14F6EC619AAF7D34594AABC5ED1347970DEC00452217CC900000008508C00000000002_cppui_modular316),
+                            g2_field_type_value::underlying_type::zero());
+                        constexpr static const g2_field_type_value twist_mul_by_q_Y = g2_field_type_value(
+                            g2_field_type_value::underlying_type(0x1680A40796537CAC0C534DB1A79BEB1400398F50AD1DEC1BCE649CF436B0F6299588459BFF27D8E6E76D5ECF1391C63_cppui_modular377),
+                            g2_field_type_value::underlying_type::zero());
                     };
 
                     constexpr typename pairing_params<curves::bls12<377>>::integral_type const
@@ -70,8 +105,30 @@ namespace nil {
 
                     constexpr typename pairing_params<curves::bls12<377>>::integral_type const
                         pairing_params<curves::bls12<377>>::final_exponent_z;
+                    constexpr typename pairing_params<curves::bls12<377>>::scalar_integral_type const
+                        pairing_params<curves::bls12<377>>::gt_frobenius_eigenvalue;
+
+                    constexpr typename pairing_params<curves::bls12<377>>::g2_field_type_value const
+                        pairing_params<curves::bls12<377>>::twist;
+                    constexpr typename pairing_params<curves::bls12<377>>::g2_field_type_value const
+                        pairing_params<curves::bls12<377>>::twist_coeff_b;
 
+                    constexpr bool const pairing_params<curves::bls12<377>>::ate_is_loop_count_neg;
                     constexpr bool const pairing_params<curves::bls12<377>>::final_exponent_is_z_neg;
+                    constexpr bool const pairing_params<curves::bls12<377>>::gt_is_frobenius_eigenvalue_neg;
+                    constexpr bool const pairing_params<curves::bls12<377>>::twist_is_d_type;
+                    constexpr bool const pairing_params<curves::bls12<377>>::ate_has_frobenius_lines;
+
+                    constexpr typename pairing_params<curves::bls12<377>>::base_field_value_type const
+                        pairing_params<curves::bls12<377>>::two_inv;
+                    constexpr typename pairing_params<curves::bls12<377>>::g2_field_type_value const
+                        pairing_params<curves::bls12<377>>::three_twist_coeff_b;
+                    constexpr typename pairing_params<curves::bls12<377>>::g2_field_type_value const
+                        pairing_params<curves::bls12<377>>::twist_inv;
+                    constexpr typename pairing_params<curves::bls12<377>>::g2_field_type_value const
+                        pairing_params<curves::bls12<377>>::twist_mul_by_q_X;
+                    constexpr typename pairing_params<curves::bls12<377>>::g2_field_type_value const
+                        pairing_params<curves::bls12<377>>::twist_mul_by_q_Y;
 
                 }    // namespace detail
             }        // namespace pairing
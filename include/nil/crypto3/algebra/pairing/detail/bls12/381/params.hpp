@@ -56,6 +56,13 @@ namespace nil {
                         constexpr static const integral_type final_exponent_z = 0xD201000000010000_cppui_modular64;
                         constexpr static const bool final_exponent_is_z_neg = true;
 
+                        using scalar_integral_type = typename curve_type::scalar_field_type::integral_type;
+
+                        /// Frobenius acts on GT as exponentiation by p = z (mod r): GT exponents split into digits of this size.
+                        constexpr static const scalar_integral_type gt_frobenius_eigenvalue =
+                            scalar_integral_type(0xD201000000010000_cppui_modular64);
+                        constexpr static const bool gt_is_frobenius_eigenvalue_neg = true;
+
                         using g2_field_type_value = typename curve_type::template g2_type<>::field_type::value_type;
 
                         constexpr static const g2_field_type_value twist =
@@ -63,6 +70,33 @@ namespace nil {
 
                         constexpr static const g2_field_type_value twist_coeff_b =
                             curve_type::template g2_type<>::params_type::b;
+
+                        /// M-type sextic twist: twist_coeff_b = b * twist.
+                        constexpr static const bool twist_is_d_type = false;
+                        /// Optimal ate for BLS12 needs no lines through Frobenius images of Q.
+                        constexpr static const bool ate_has_frobenius_lines = false;
+
+                        using base_field_value_type = typename curve_type::base_field_type::value_type;
+
+                        /// Constants of the Miller loop, so that precomputations do no inversions of their own.
+                        constexpr static const base_field_value_type two_inv = base_field_value_type(
+                            0xD0088F51CBFF34D258DD3DB21A5D66BB23BA5C279C2895FB39869507B587B120F55FFFF58A9FFFFDCFF7FFFFFFFD556_cppui_modular380);
+                        /// 3 * twist_coeff_b, the only multiple of b the projective doubling step needs.
+                        constexpr static const g2_field_type_value three_twist_coeff_b = g2_field_type_value(
+                            g2_field_type_value::underlying_type(0xC_cppui_modular4),
+                            g2_field_type_value::underlying_type(0xC_cppui_modular4));
+                        constexpr static const g2_field_type_value twist_inv = g2_field_type_value(
+                            g2_field_type_value::underlying_type(0xD0088F51CBFF34D258DD3DB21A5D66BB23BA5C279C2895FB39869507B587B120F55FFFF58A9FFFFDCFF7FFFFFFFD556_cppui_modular380),
+                            g2_field_type_value::underlying_type(0xD0088F51CBFF34D258DD3DB21A5D66BB23BA5C279C2895FB39869507B587B120F55FFFF58A9FFFFDCFF7FFFFFFFD555_cppui_modular380));
+
+                        /// Frobenius endomorphism on the twist: psi(x, y) = (x^p * twist_mul_by_q_X, y^p * twist_mul_by_q_Y),
+                        /// twist_mul_by_q_X = twist^(-(p-1)/3), twist_mul_by_q_Y = twist^(-(p-1)/2) for the M-type twist.
+                        constexpr static const g2_field_type_value twist_mul_by_q_X = g2_field_type_value(
+                            g2_field_type_value::underlying_type::zero(),
+                            g2_field_type_value::underlying_type(0x1A0111EA397FE699EC02408663D4DE85AA0D857D89759AD4897D29650FB85F9B409427EB4F49FFFD8BFD00000000AAAD_cppui_modular381));
+                        constexpr static const g2_field_type_value twist_mul_by_q_Y = g2_field_type_value(
+                            g2_field_type_value::underlying_type(0x135203E60180A68EE2E9C448D77A2CD91C3DEDD930B1CF60EF396489F61EB45E304466CF3E67FA0AF1EE7B04121BDEA2_cppui_modular381),
+                            g2_field_type_value::underlying_type(0x6AF0E0437FF400B6831E36D6BD17FFE48395DABC2D3435E77F76E17009241C5EE67992F72EC05F4C81084FBEDE3CC09_cppui_modular379));
                     };
 
                     constexpr typename pairing_params<curves::bls12<381>>::integral_type const
@@ -70,12 +104,28 @@ namespace nil {
 
                     constexpr typename pairing_params<curves::bls12<381>>::integral_type const
                         pairing_params<curves::bls12<381>>::final_exponent_z;
+                    constexpr typename pairing_params<curves::bls12<381>>::scalar_integral_type const
+                        pairing_params<curves::bls12<381>>::gt_frobenius_eigenvalue;
                     constexpr typename pairing_params<curves::bls12<381>>::g2_field_type_value const
                         pairing_params<curves::bls12<381>>::twist;
                     constexpr typename pairing_params<curves::bls12<381>>::g2_field_type_value const
                         pairing_params<curves::bls12<381>>::twist_coeff_b;
 
                     constexpr bool const pairing_params<curves::bls12<381>>::final_exponent_is_z_neg;
+                    constexpr bool const pairing_params<curves::bls12<381>>::gt_is_frobenius_eigenvalue_neg;
+                    constexpr bool const pairing_params<curves::bls12<381>>::twist_is_d_type;
+                    constexpr bool const pairing_params<curves::bls12<381>>::ate_has_frobenius_lines;
+
+                    constexpr typename pairing_params<curves::bls12<381>>::base_field_value_type const
+                        pairing_params<curves::bls12<381>>::two_inv;
+                    constexpr typename pairing_params<curves::bls12<381>>::g2_field_type_value const
+                        pairing_params<curves::bls12<381>>::three_twist_coeff_b;
+                    constexpr typename pairing_params<curves::bls12<381>>::g2_field_type_value const
+                        pairing_params<curves::bls12<381>>::twist_inv;
+                    constexpr typename pairing_params<curves::bls12<381>>::g2_field_type_value const
+                        pairing_params<curves::bls12<381>>::twist_mul_by_q_X;
+                    constexpr typename pairing_params<curves::bls12<381>>::g2_field_type_value const
+                        pairing_params<curves::bls12<381>>::twist_mul_by_q_Y;
 
                 }    // namespace detail
             }        // namespace pairing
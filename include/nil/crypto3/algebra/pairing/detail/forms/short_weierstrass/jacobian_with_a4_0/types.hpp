@@ -26,8 +26,14 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_TYPES_POLICY_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_TYPES_POLICY_HPP
 
-#include <vector>
+#include <array>
+#include <iterator>
 #include <iostream>
+#include <algorithm>
+#include <cstdint>
+
+#include <boost/multiprecision/number.hpp>
+#include <boost/multiprecision/cpp_int/import_export.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -35,9 +41,56 @@ namespace nil {
             namespace pairing {
                 namespace detail {
 
+                    template<typename CurveType>
+                    class pairing_params;
+
+                    /// Signed binary expansion, least significant digit first; digits[size - 1] is the leading one.
+                    template<std::size_t MaxSize>
+                    struct signed_digits_type {
+                        std::array<std::int8_t, MaxSize> digits;
+                        std::size_t size;
+                        std::size_t nonzero;
+                    };
+
+                    template<std::size_t MaxSize, typename IntegralType>
+                    constexpr signed_digits_type<MaxSize> binary_signed_digits(const IntegralType &k) {
+                        signed_digits_type<MaxSize> result = {};
+                        for (std::size_t i = 0; i < MaxSize; ++i) {
+                            if (boost::multiprecision::bit_test(k, i)) {
+                                result.digits[i] = 1;
+                                result.size = i + 1;
+                                ++result.nonzero;
+                            }
+                        }
+                        return result;
+                    }
+
+                    /// Non-adjacent form, built from the bits of k with a carry instead of arithmetic on k.
+                    template<std::size_t MaxSize, typename IntegralType>
+                    constexpr signed_digits_type<MaxSize> naf_signed_digits(const IntegralType &k) {
+                        signed_digits_type<MaxSize> result = {};
+                        unsigned carry = 0;
+                        for (std::size_t i = 0; i + 1 < MaxSize; ++i) {
+                            const unsigned b = (boost::multiprecision::bit_test(k, i) ? 1u : 0u) + carry;
+                            if (b == 1) {
+                                /* remaining value is 1 or 3 mod 4 */
+                                const bool next = boost::multiprecision::bit_test(k, i + 1);
+                                result.digits[i] = next ? -1 : 1;
+                                carry = next ? 1 : 0;
+                                result.size = i + 1;
+                                ++result.nonzero;
+                            } else {
+                                carry = b >> 1;
+                            }
+                        }
+                        return result;
+                    }
+
                     template<typename CurveType>
                     class short_weierstrass_jacobian_with_a4_0_types_policy {
                         using curve_type = CurveType;
+                        using params_type = pairing_params<curve_type>;
+                        using base_field_type = typename curve_type::base_field_type;
 
                     public:
                         using integral_type = typename curve_type::base_field_type::integral_type;
@@ -46,6 +99,30 @@ namespace nil {
                         using g1_field_value_type = typename curve_type::base_field_type::value_type;
                         using g2_field_value_type = typename curve_type::template g2_type<>::field_type::value_type;
 
+                        using ate_loop_count_digits_type = signed_digits_type<params_type::integral_type_max_bits + 2>;
+
+                        constexpr static const ate_loop_count_digits_type ate_loop_count_binary_digits =
+                            binary_signed_digits<params_type::integral_type_max_bits + 2>(params_type::ate_loop_count);
+                        constexpr static const ate_loop_count_digits_type ate_loop_count_naf_digits =
+                            naf_signed_digits<params_type::integral_type_max_bits + 2>(params_type::ate_loop_count);
+
+                        /// Digits of ate_loop_count walked by the Miller loop, from digits[size - 2] down to
+                        /// digits[0]: a doubling step per digit, plus an addition of Q or -Q per nonzero digit.
+                        /// A doubling step costs a squaring of f and a line, an addition step only a line:
+                        /// NAF trades additions for at most one extra doubling, which pays off for BN's 6u+2
+                        /// but not for the sparse u of BLS12 curves.
+                        constexpr static const ate_loop_count_digits_type ate_loop_count_digits =
+                            (2 * ate_loop_count_naf_digits.size + ate_loop_count_naf_digits.nonzero <
+                             2 * ate_loop_count_binary_digits.size + ate_loop_count_binary_digits.nonzero) ?
+                                ate_loop_count_naf_digits :
+                                ate_loop_count_binary_digits;
+
+                        /// Number of line coefficients produced by the G2 precomputation, including the
+                        /// two lines through Frobenius images of Q for BN curves.
+                        constexpr static const std::size_t ate_g2_coeffs_count =
+                            (ate_loop_count_digits.size - 1) + (ate_loop_count_digits.nonzero - 1) +
+                            (params_type::ate_has_frobenius_lines ? 2 : 0);
+
                         struct ate_g1_precomputed_type {
 
                             g1_field_value_type PX;
@@ -68,21 +145,122 @@ namespace nil {
                             }
                         };
 
+                        /// Octets per base field element in the serialized form, big-endian.
+                        constexpr static const std::size_t base_field_octets =
+                            base_field_type::modulus_bits / 8 + (base_field_type::modulus_bits % 8 ? 1 : 0);
+                        constexpr static const std::size_t g2_field_octets =
+                            std::tuple_size<typename g2_field_value_type::data_type>::value * base_field_octets;
+
                         struct ate_g2_precomputed_type {
                             using coeffs_type = ate_ell_coeffs;
+                            /// Line coefficients count is fixed by the curve's ate_loop_count,
+                            /// so the precomputation is stored inline without heap allocation.
+                            using coeffs_container_type = std::array<coeffs_type, ate_g2_coeffs_count>;
+
+                            /// Size of the byte representation: QX, QY, then (ell_0, ell_VW, ell_VV) per line.
+                            constexpr static const std::size_t serialized_size =
+                                (2 + 3 * ate_g2_coeffs_count) * g2_field_octets;
 
                             g2_field_value_type QX;
                             g2_field_value_type QY;
-                            std::vector<coeffs_type> coeffs;
+                            coeffs_container_type coeffs;
 
                             bool operator==(const ate_g2_precomputed_type &other) const {
                                 return (this->QX == other.QX && this->QY == other.QY && this->coeffs == other.coeffs);
                             }
+
+                            /// Writes exactly serialized_size octets to out, returns the advanced iterator.
+                            template<typename OutputIterator>
+                            OutputIterator to_bytes(OutputIterator out) const {
+                                out = g2_field_element_to_bytes(QX, out);
+                                out = g2_field_element_to_bytes(QY, out);
+                                for (const coeffs_type &c : coeffs) {
+                                    out = g2_field_element_to_bytes(c.ell_0, out);
+                                    out = g2_field_element_to_bytes(c.ell_VW, out);
+                                    out = g2_field_element_to_bytes(c.ell_VV, out);
+                                }
+                                return out;
+                            }
+
+                            /// Reads serialized_size octets written by to_bytes. Returns false if the
+                            /// input has a wrong length or any coordinate is not reduced modulo p.
+                            template<typename InputIterator>
+                            bool from_bytes(InputIterator first, InputIterator last) {
+                                if (std::distance(first, last) != static_cast<std::ptrdiff_t>(serialized_size)) {
+                                    return false;
+                                }
+
+                                bool valid = g2_field_element_from_bytes(first, QX);
+                                valid &= g2_field_element_from_bytes(first, QY);
+                                for (coeffs_type &c : coeffs) {
+                                    valid &= g2_field_element_from_bytes(first, c.ell_0);
+                                    valid &= g2_field_element_from_bytes(first, c.ell_VW);
+                                    valid &= g2_field_element_from_bytes(first, c.ell_VV);
+                                }
+                                return valid;
+                            }
+                        };
+
+                        /// Line through affine points of the twist, scaled so that the coefficient of yP is one:
+                        /// it is evaluated at P with a single Fp*Fp2 product (PX * ell_VV).
+                        struct affine_ate_ell_coeffs {
+
+                            g2_field_value_type ell_0;
+                            g2_field_value_type ell_VV;
+
+                            bool operator==(const affine_ate_ell_coeffs &other) const {
+                                return (this->ell_0 == other.ell_0 && this->ell_VV == other.ell_VV);
+                            }
+                        };
+
+                        struct affine_ate_g2_precomputed_type {
+                            using coeffs_type = affine_ate_ell_coeffs;
+                            using coeffs_container_type = std::array<coeffs_type, ate_g2_coeffs_count>;
+
+                            g2_field_value_type QX;
+                            g2_field_value_type QY;
+                            coeffs_container_type coeffs;
+
+                            bool operator==(const affine_ate_g2_precomputed_type &other) const {
+                                return (this->QX == other.QX && this->QY == other.QY && this->coeffs == other.coeffs);
+                            }
                         };
 
                         typedef ate_g1_precomputed_type g1_precomputed_type;
                         typedef ate_g2_precomputed_type g2_precomputed_type;
+                        typedef affine_ate_g2_precomputed_type affine_g2_precomputed_type;
 
+                    private:
+                        template<typename OutputIterator>
+                        static OutputIterator g2_field_element_to_bytes(const g2_field_value_type &element,
+                                                                        OutputIterator out) {
+                            for (const auto &coordinate : element.data) {
+                                std::array<std::uint8_t, base_field_octets> octets = {0};
+                                boost::multiprecision::export_bits(
+                                    coordinate.data.template convert_to<integral_type>(), octets.rbegin(), 8, false);
+                                out = std::copy(octets.begin(), octets.end(), out);
+                            }
+                            return out;
+                        }
+
+                        template<typename InputIterator>
+                        static bool g2_field_element_from_bytes(InputIterator &first, g2_field_value_type &element) {
+                            bool valid = true;
+                            for (auto &coordinate : element.data) {
+                                std::array<std::uint8_t, base_field_octets> octets;
+                                for (std::uint8_t &octet : octets) {
+                                    octet = static_cast<std::uint8_t>(*first);
+                                    ++first;
+                                }
+                                integral_type value;
+                                boost::multiprecision::import_bits(value, octets.begin(), octets.end(), 8, true);
+                                valid &= (value < base_field_type::modulus);
+                                coordinate = typename base_field_type::value_type(value);
+                            }
+                            return valid;
+                        }
+
+                    public:
                         friend std::ostream& operator<<(std::ostream& os, ate_g1_precomputed_type const& p)
                         {
                             os << "{" << std::endl
@@ -91,6 +269,23 @@ namespace nil {
                             return os;
                         }
 
+                        friend std::ostream& operator<<(std::ostream& os, affine_ate_g2_precomputed_type const& p)
+                        {
+                            os << "{" << std::endl
+                                << "\"QX\":" << p.QX << "," << std::endl
+                                << "\"QY\":" << p.QY << "," << std::endl
+                                << "\"coeffs\":[" << std::endl;
+                            for(auto d = p.coeffs.begin(); d != p.coeffs.end(); ++d) {
+                                os << "[" << d->ell_0 << "," << d->ell_VV << "]";
+                                if (d != p.coeffs.end()) {
+                                    os << "," << std::endl;
+                                }
+                            }
+                            os << "]" << std::endl;
+                            os << "}";
+                            return os;
+                        }
+
                         friend std::ostream& operator<<(std::ostream& os, ate_g2_precomputed_type const& p)
                         {
                             os << "{" << std::endl
@@ -69,6 +69,15 @@ namespace nil {
                             curve_type::template g2_type<>::params_type::a;
                         constexpr static const g2_field_type_value twist_coeff_b =
                             curve_type::template g2_type<>::params_type::b;
+
+                        /// Powers of the twist used by the precomputations, fixed at compile time.
+                        constexpr static const g2_field_type_value twist_inv =
+                            g2_field_type_value(g2_field_type_value::underlying_type::zero(),
+                                                g2_field_type_value::underlying_type(
+                                                    0x2A381B277D9275728E7C1A9A519803015AF8CFE7CE197C337156670FAE015727930C8843C3D_cppui_modular298));
+                        constexpr static const g2_field_type_value twist_squared =
+                            g2_field_type_value(g2_field_type_value::underlying_type(0x11u),
+                                                g2_field_type_value::underlying_type::zero());
                     };
 
                     constexpr typename pairing_params<curves::mnt4<298>>::integral_type const
@@ -86,6 +95,10 @@ namespace nil {
                         pairing_params<curves::mnt4<298>>::twist_coeff_a;
                     constexpr typename pairing_params<curves::mnt4<298>>::g2_field_type_value const
                         pairing_params<curves::mnt4<298>>::twist_coeff_b;
+                    constexpr typename pairing_params<curves::mnt4<298>>::g2_field_type_value const
+                        pairing_params<curves::mnt4<298>>::twist_inv;
+                    constexpr typename pairing_params<curves::mnt4<298>>::g2_field_type_value const
+                        pairing_params<curves::mnt4<298>>::twist_squared;
 
                     constexpr bool const pairing_params<curves::mnt4<298>>::ate_is_loop_count_neg;
                     constexpr bool const pairing_params<curves::mnt4<298>>::final_exponent_last_chunk_is_w0_neg;
@@ -70,6 +70,17 @@ namespace nil {
                             curve_type::template g2_type<>::params_type::a;
                         constexpr static const g2_field_type_value twist_coeff_b =
                             curve_type::template g2_type<>::params_type::b;
+
+                        /// Powers of the twist used by the precomputations, fixed at compile time.
+                        constexpr static const g2_field_type_value twist_inv =
+                            g2_field_type_value(g2_field_type_value::underlying_type::zero(),
+                                                g2_field_type_value::underlying_type::zero(),
+                                                g2_field_type_value::underlying_type(
+                                                    0x17EC97EBB617428DB7243135505EAC5EA27BEC81A3B97B6EB363A8BC454B14E150E66666667_cppui_modular297));
+                        constexpr static const g2_field_type_value twist_squared =
+                            g2_field_type_value(g2_field_type_value::underlying_type::zero(),
+                                                g2_field_type_value::underlying_type::zero(),
+                                                g2_field_type_value::underlying_type::one());
                     };
 
                     constexpr typename pairing_params<curves::mnt6<298>>::integral_type const
@@ -87,6 +98,10 @@ namespace nil {
                         pairing_params<curves::mnt6<298>>::twist_coeff_a;
                     constexpr typename pairing_params<curves::mnt6<298>>::g2_field_type_value const
                         pairing_params<curves::mnt6<298>>::twist_coeff_b;
+                    constexpr typename pairing_params<curves::mnt6<298>>::g2_field_type_value const
+                        pairing_params<curves::mnt6<298>>::twist_inv;
+                    constexpr typename pairing_params<curves::mnt6<298>>::g2_field_type_value const
+                        pairing_params<curves::mnt6<298>>::twist_squared;
 
                     constexpr bool const pairing_params<curves::mnt6<298>>::ate_is_loop_count_neg;
                     constexpr bool const pairing_params<curves::mnt6<298>>::final_exponent_last_chunk_is_w0_neg;
@@ -30,6 +30,7 @@
 #include <nil/crypto3/algebra/pairing/detail/edwards/183/params.hpp>
 #include <nil/crypto3/algebra/pairing/edwards/183/ate_double_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/edwards/183/ate_miller_loop.hpp>
+#include <nil/crypto3/algebra/pairing/edwards/183/ate_multi_miller_loop.hpp>
 #include <nil/crypto3/algebra/pairing/edwards/183/ate_precompute_g1.hpp>
 #include <nil/crypto3/algebra/pairing/edwards/183/ate_precompute_g2.hpp>
 #include <nil/crypto3/algebra/pairing/edwards/183/final_exponentiation.hpp>
@@ -48,6 +49,7 @@ namespace nil {
                     using precompute_g2 = pairing::edwards_ate_precompute_g2<183>;
                     using miller_loop = pairing::edwards_ate_miller_loop<183>;
                     using double_miller_loop = pairing::edwards_ate_double_miller_loop<183>;
+                    using multi_miller_loop = pairing::edwards_ate_multi_miller_loop<183>;
                     using final_exponentiation = pairing::edwards_final_exponentiation<183>;
 
                     using g1_precomputed_type = typename precompute_g1::g1_precomputed_type;
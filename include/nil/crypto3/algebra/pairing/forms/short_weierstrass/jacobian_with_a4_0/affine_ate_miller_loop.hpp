@@ -0,0 +1,120 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_AFFINE_ATE_MILLER_LOOP_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_AFFINE_ATE_MILLER_LOOP_HPP
+
+#include <type_traits>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /** @brief Miller loop over lines precomputed by
+                 *  short_weierstrass_jacobian_with_a4_0_affine_ate_precompute_g2.
+                 *  The result differs from the projective Miller loop by a factor killed by the final
+                 *  exponentiation, so only reduced pairings are comparable.
+                 */
+                template<typename CurveType>
+                class short_weierstrass_jacobian_with_a4_0_affine_ate_miller_loop {
+                    using curve_type = CurveType;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+
+                    using gt_type = typename curve_type::gt_type;
+
+                    /* D-type lines fill slots 0, 2 and 4 of f, M-type ones slots 0, 4 and 5 */
+                    typedef std::integral_constant<bool, params_type::twist_is_d_type> twist_is_d_type;
+
+                    static typename gt_type::value_type
+                        mul_by_line(const typename gt_type::value_type &f,
+                                    const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                    const typename policy_type::affine_ate_ell_coeffs &c) {
+
+                        return mul_by_line(f, prec_P, c, twist_is_d_type());
+                    }
+
+                    static typename gt_type::value_type
+                        mul_by_line(const typename gt_type::value_type &f,
+                                    const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                    const typename policy_type::affine_ate_ell_coeffs &c, std::true_type) {
+
+                        return f.mul_by_024(c.ell_0, prec_P.PY, prec_P.PX * c.ell_VV);
+                    }
+
+                    static typename gt_type::value_type
+                        mul_by_line(const typename gt_type::value_type &f,
+                                    const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                    const typename policy_type::affine_ate_ell_coeffs &c, std::false_type) {
+
+                        return f.mul_by_045(c.ell_0, prec_P.PY, prec_P.PX * c.ell_VV);
+                    }
+
+                public:
+                    static typename gt_type::value_type
+                        process(const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                const typename policy_type::affine_ate_g2_precomputed_type &prec_Q) {
+
+                        typename gt_type::value_type f = gt_type::value_type::one();
+
+                        const typename policy_type::ate_loop_count_digits_type &digits =
+                            policy_type::ate_loop_count_digits;
+
+                        std::size_t idx = 0;
+
+                        for (long i = static_cast<long>(digits.size) - 2; i >= 0; --i) {
+                            f = f.squared();
+                            f = mul_by_line(f, prec_P, prec_Q.coeffs[idx++]);
+
+                            if (digits.digits[i] != 0) {
+                                f = mul_by_line(f, prec_P, prec_Q.coeffs[idx++]);
+                            }
+                        }
+
+                        if (params_type::ate_is_loop_count_neg) {
+                            f = f.inversed();
+                        }
+
+                        if (params_type::ate_has_frobenius_lines) {
+                            f = mul_by_line(f, prec_P, prec_Q.coeffs[idx++]);
+                            f = mul_by_line(f, prec_P, prec_Q.coeffs[idx++]);
+                        }
+
+                        BOOST_ASSERT(idx == prec_Q.coeffs.size());
+
+                        return f;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_AFFINE_ATE_MILLER_LOOP_HPP
@@ -0,0 +1,181 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_AFFINE_ATE_PRECOMPUTE_G2_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_AFFINE_ATE_PRECOMPUTE_G2_HPP
+
+#include <type_traits>
+
+#include <boost/assert.hpp>
+
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /** @brief G2 precomputation for the affine ate Miller loop of BLS12 and BN curves.
+                 *
+                 *  R walks the loop in affine coordinates of the twist, one Fp2 inversion per step,
+                 *  which is affordable when Q is fixed (verification keys, KZG [tau]_2) and precomputed once.
+                 *  Each line is stored scaled so that its yP coefficient is one: the scaling factor lies in
+                 *  a proper subfield of Fp12 and is killed by the final exponentiation.
+                 */
+                template<typename CurveType>
+                class short_weierstrass_jacobian_with_a4_0_affine_ate_precompute_g2 {
+                    using curve_type = CurveType;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+
+                    using g2_type = typename curve_type::template g2_type<>;
+                    using g2_affine_type = typename curve_type::template g2_type<curves::coordinates::affine>;
+
+                    using g2_field_type_value = typename g2_type::field_type::value_type;
+
+                    /* Line of slope lambda through (x, y), untwisted to E(Fp12).
+                       M-type: l = yP + ((lambda*x - y)/twist) * v*w + (-lambda/twist) * xP * v^2*w
+                       D-type: l * w^3 = twist*(lambda*x - y) + (-lambda) * xP * v^2 + yP * v*w */
+                    static void line_coeffs(const g2_field_type_value &lambda, const g2_field_type_value &x,
+                                            const g2_field_type_value &y, const g2_field_type_value &twist_inv,
+                                            typename policy_type::affine_ate_ell_coeffs &c) {
+
+                        line_coeffs(lambda, lambda * x - y, twist_inv, c,
+                                    std::integral_constant<bool, params_type::twist_is_d_type>());
+                    }
+
+                    static void line_coeffs(const g2_field_type_value &lambda, const g2_field_type_value &c0,
+                                            const g2_field_type_value &, typename policy_type::affine_ate_ell_coeffs &c,
+                                            std::true_type) {
+
+                        c.ell_0 = params_type::twist * c0;    // ell_0 = twist * (lambda * x - y)
+                        c.ell_VV = -lambda;                   // ell_VV = -lambda (later: * xP)
+                    }
+
+                    static void line_coeffs(const g2_field_type_value &lambda, const g2_field_type_value &c0,
+                                            const g2_field_type_value &twist_inv,
+                                            typename policy_type::affine_ate_ell_coeffs &c, std::false_type) {
+
+                        c.ell_0 = c0 * twist_inv;            // ell_0 = (lambda * x - y) / twist
+                        c.ell_VV = -(lambda * twist_inv);    // ell_VV = -lambda / twist (later: * xP)
+                    }
+
+                    static void doubling_step(g2_field_type_value &RX, g2_field_type_value &RY,
+                                              const g2_field_type_value &twist_inv,
+                                              typename policy_type::affine_ate_ell_coeffs &c) {
+
+                        const g2_field_type_value RX_squared = RX.squared();
+                        const g2_field_type_value lambda =
+                            (RX_squared.doubled() + RX_squared) * RY.doubled().inversed();    // 3 * x^2 / (2 * y)
+
+                        line_coeffs(lambda, RX, RY, twist_inv, c);
+
+                        const g2_field_type_value X3 = lambda.squared() - RX.doubled();
+                        RY = lambda * (RX - X3) - RY;
+                        RX = X3;
+                    }
+
+                    static void addition_step(g2_field_type_value &RX, g2_field_type_value &RY,
+                                              const g2_field_type_value &QX, const g2_field_type_value &QY,
+                                              const g2_field_type_value &twist_inv,
+                                              typename policy_type::affine_ate_ell_coeffs &c) {
+
+                        const g2_field_type_value lambda = (RY - QY) * (RX - QX).inversed();
+
+                        line_coeffs(lambda, QX, QY, twist_inv, c);
+
+                        const g2_field_type_value X3 = lambda.squared() - RX - QX;
+                        RY = lambda * (RX - X3) - RY;
+                        RX = X3;
+                    }
+
+                public:
+                    using g2_precomputed_type = typename policy_type::affine_ate_g2_precomputed_type;
+
+                    static g2_precomputed_type process(const typename g2_type::value_type &Q) {
+
+                        g2_precomputed_type result;
+
+                        if (Q.is_zero()) {
+                            /* all-zero lines evaluate to yP (or yP*v*w), which the final exponentiation kills */
+                            result.QX = result.QY = g2_field_type_value::zero();
+                            for (auto &c : result.coeffs) {
+                                c.ell_0 = c.ell_VV = g2_field_type_value::zero();
+                            }
+                            return result;
+                        }
+
+                        typename g2_affine_type::value_type Qcopy = Q.to_affine();
+                        result.QX = Qcopy.X;
+                        result.QY = Qcopy.Y;
+
+                        const g2_field_type_value &twist_inv = params_type::twist_inv;
+
+                        g2_field_type_value RX = Qcopy.X;
+                        g2_field_type_value RY = Qcopy.Y;
+
+                        const g2_field_type_value minus_QY = -result.QY;
+
+                        const typename policy_type::ate_loop_count_digits_type &digits =
+                            policy_type::ate_loop_count_digits;
+
+                        std::size_t idx = 0;
+
+                        for (long i = static_cast<long>(digits.size) - 2; i >= 0; --i) {
+                            doubling_step(RX, RY, twist_inv, result.coeffs[idx++]);
+
+                            if (digits.digits[i] > 0) {
+                                addition_step(RX, RY, result.QX, result.QY, twist_inv, result.coeffs[idx++]);
+                            } else if (digits.digits[i] < 0) {
+                                addition_step(RX, RY, result.QX, minus_QY, twist_inv, result.coeffs[idx++]);
+                            }
+                        }
+
+                        if (params_type::ate_has_frobenius_lines) {
+                            /* Q1 = pi(Q), Q2 = -pi^2(Q) */
+                            const g2_field_type_value Q1X = result.QX.Frobenius_map(1) * params_type::twist_mul_by_q_X;
+                            const g2_field_type_value Q1Y = result.QY.Frobenius_map(1) * params_type::twist_mul_by_q_Y;
+                            const g2_field_type_value Q2X = Q1X.Frobenius_map(1) * params_type::twist_mul_by_q_X;
+                            const g2_field_type_value Q2Y = -(Q1Y.Frobenius_map(1) * params_type::twist_mul_by_q_Y);
+
+                            if (params_type::ate_is_loop_count_neg) {
+                                RY = -RY;
+                            }
+
+                            addition_step(RX, RY, Q1X, Q1Y, twist_inv, result.coeffs[idx++]);
+                            addition_step(RX, RY, Q2X, Q2Y, twist_inv, result.coeffs[idx++]);
+                        }
+
+                        BOOST_ASSERT(idx == result.coeffs.size());
+
+                        return result;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_AFFINE_ATE_PRECOMPUTE_G2_HPP
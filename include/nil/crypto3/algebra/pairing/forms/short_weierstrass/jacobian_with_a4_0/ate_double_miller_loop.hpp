@@ -26,8 +26,9 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_DOUBLE_MILLER_LOOP_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_DOUBLE_MILLER_LOOP_HPP
 
-#include <boost/multiprecision/number.hpp>
-#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+#include <type_traits>
+
+#include <boost/assert.hpp>
 
 #include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
 
@@ -45,6 +46,69 @@ namespace nil {
 
                     using gt_type = typename curve_type::gt_type;
 
+                    /* D-type lines fill slots 0, 2 and 4 of f, M-type ones slots 0, 4 and 5 */
+                    typedef std::integral_constant<bool, params_type::twist_is_d_type> twist_is_d_type;
+
+                    static typename gt_type::value_type
+                        mul_by_line(const typename gt_type::value_type &f,
+                                    const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                    const typename policy_type::ate_ell_coeffs &c) {
+
+                        return mul_by_line(f, prec_P, c, twist_is_d_type());
+                    }
+
+                    static typename gt_type::value_type
+                        mul_by_line(const typename gt_type::value_type &f,
+                                    const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                    const typename policy_type::ate_ell_coeffs &c, std::true_type) {
+
+                        return f.mul_by_024(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+                    }
+
+                    static typename gt_type::value_type
+                        mul_by_line(const typename gt_type::value_type &f,
+                                    const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                    const typename policy_type::ate_ell_coeffs &c, std::false_type) {
+
+                        return f.mul_by_045(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+                    }
+
+                    /* Two sparse lines multiplied together first, then into f with one product that skips the
+                       zero slot of the line product (slot 5 for D-type lines, slot 3 for M-type ones) */
+                    static typename gt_type::value_type
+                        mul_by_line_product(const typename gt_type::value_type &f,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P1,
+                                            const typename policy_type::ate_ell_coeffs &c1,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P2,
+                                            const typename policy_type::ate_ell_coeffs &c2) {
+
+                        return mul_by_line_product(f, prec_P1, c1, prec_P2, c2, twist_is_d_type());
+                    }
+
+                    static typename gt_type::value_type
+                        mul_by_line_product(const typename gt_type::value_type &f,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P1,
+                                            const typename policy_type::ate_ell_coeffs &c1,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P2,
+                                            const typename policy_type::ate_ell_coeffs &c2, std::true_type) {
+
+                        return f.mul_by_01234(gt_type::value_type::mul_024_by_024(
+                            c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV,
+                            c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV));
+                    }
+
+                    static typename gt_type::value_type
+                        mul_by_line_product(const typename gt_type::value_type &f,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P1,
+                                            const typename policy_type::ate_ell_coeffs &c1,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P2,
+                                            const typename policy_type::ate_ell_coeffs &c2, std::false_type) {
+
+                        return f.mul_by_01245(gt_type::value_type::mul_045_by_045(
+                            c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV,
+                            c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV));
+                    }
+
                 public:
                     static typename gt_type::value_type
                         process(const typename policy_type::ate_g1_precomputed_type &prec_P1,
@@ -54,39 +118,24 @@ namespace nil {
 
                         typename gt_type::value_type f = gt_type::value_type::one();
 
-                        bool found_one = false;
-                        std::size_t idx = 0;
-
-                        const typename policy_type::integral_type &loop_count = params_type::ate_loop_count;
-
-                        for (long i = params_type::integral_type_max_bits; i >= 0; --i) {
-                            const bool bit = boost::multiprecision::bit_test(loop_count, i);
-                            if (!found_one) {
-                                /* this skips the MSB itself */
-                                found_one |= bit;
-                                continue;
-                            }
-
-                            /* code below gets executed for all bits (EXCEPT the MSB itself) of
-                               param_p (skipping leading zeros) in MSB to LSB
-                               order */
+                        const typename policy_type::ate_loop_count_digits_type &digits =
+                            policy_type::ate_loop_count_digits;
 
-                            typename policy_type::ate_ell_coeffs c1 = prec_Q1.coeffs[idx];
-                            typename policy_type::ate_ell_coeffs c2 = prec_Q2.coeffs[idx];
-                            ++idx;
+                        std::size_t idx = 0;
 
+                        for (long i = static_cast<long>(digits.size) - 2; i >= 0; --i) {
                             f = f.squared();
 
-                            f = f.mul_by_045(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-                            f = f.mul_by_045(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+                            const typename policy_type::ate_ell_coeffs &c1 = prec_Q1.coeffs[idx];
+                            const typename policy_type::ate_ell_coeffs &c2 = prec_Q2.coeffs[idx];
+                            ++idx;
 
-                            if (bit) {
-                                typename policy_type::ate_ell_coeffs c1 = prec_Q1.coeffs[idx];
-                                typename policy_type::ate_ell_coeffs c2 = prec_Q2.coeffs[idx];
+                            if (digits.digits[i] != 0) {
+                                f = mul_by_line_product(f, prec_P1, c1, prec_P1, prec_Q1.coeffs[idx]);
+                                f = mul_by_line_product(f, prec_P2, c2, prec_P2, prec_Q2.coeffs[idx]);
                                 ++idx;
-
-                                f = f.mul_by_045(c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV);
-                                f = f.mul_by_045(c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV);
+                            } else {
+                                f = mul_by_line_product(f, prec_P1, c1, prec_P2, c2);
                             }
                         }
 
@@ -94,6 +143,16 @@ namespace nil {
                             f = f.inversed();
                         }
 
+                        if (params_type::ate_has_frobenius_lines) {
+                            f = mul_by_line_product(f, prec_P1, prec_Q1.coeffs[idx], prec_P1,
+                                                    prec_Q1.coeffs[idx + 1]);
+                            f = mul_by_line_product(f, prec_P2, prec_Q2.coeffs[idx], prec_P2,
+                                                    prec_Q2.coeffs[idx + 1]);
+                            idx += 2;
+                        }
+
+                        BOOST_ASSERT(idx == prec_Q1.coeffs.size());
+
                         return f;
                     }
                 };
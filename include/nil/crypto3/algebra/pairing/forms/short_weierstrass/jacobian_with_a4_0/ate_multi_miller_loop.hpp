@@ -0,0 +1,159 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_MULTI_MILLER_LOOP_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_MULTI_MILLER_LOOP_HPP
+
+#include <type_traits>
+
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /** @brief Product of Miller loops over a range of (g1 precomputed, g2 precomputed) pairs:
+                 *  the squaring of f is shared, each pair only contributes its line multiplications.
+                 */
+                template<typename CurveType>
+                class short_weierstrass_jacobian_with_a4_0_ate_multi_miller_loop {
+                    using curve_type = CurveType;
+
+                    using params_type = detail::pairing_params<curve_type>;
+                    typedef detail::short_weierstrass_jacobian_with_a4_0_types_policy<curve_type> policy_type;
+
+                    using gt_type = typename curve_type::gt_type;
+
+                    /* D-type lines fill slots 0, 2 and 4 of f, M-type ones slots 0, 4 and 5 */
+                    typedef std::integral_constant<bool, params_type::twist_is_d_type> twist_is_d_type;
+
+                    static typename gt_type::value_type
+                        mul_by_line(const typename gt_type::value_type &f,
+                                    const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                    const typename policy_type::ate_ell_coeffs &c) {
+
+                        return mul_by_line(f, prec_P, c, twist_is_d_type());
+                    }
+
+                    static typename gt_type::value_type
+                        mul_by_line(const typename gt_type::value_type &f,
+                                    const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                    const typename policy_type::ate_ell_coeffs &c, std::true_type) {
+
+                        return f.mul_by_024(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+                    }
+
+                    static typename gt_type::value_type
+                        mul_by_line(const typename gt_type::value_type &f,
+                                    const typename policy_type::ate_g1_precomputed_type &prec_P,
+                                    const typename policy_type::ate_ell_coeffs &c, std::false_type) {
+
+                        return f.mul_by_045(c.ell_0, prec_P.PY * c.ell_VW, prec_P.PX * c.ell_VV);
+                    }
+
+                    /* Two sparse lines multiplied together first, then into f with one product that skips the
+                       zero slot of the line product (slot 5 for D-type lines, slot 3 for M-type ones) */
+                    static typename gt_type::value_type
+                        mul_by_line_product(const typename gt_type::value_type &f,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P1,
+                                            const typename policy_type::ate_ell_coeffs &c1,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P2,
+                                            const typename policy_type::ate_ell_coeffs &c2) {
+
+                        return mul_by_line_product(f, prec_P1, c1, prec_P2, c2, twist_is_d_type());
+                    }
+
+                    static typename gt_type::value_type
+                        mul_by_line_product(const typename gt_type::value_type &f,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P1,
+                                            const typename policy_type::ate_ell_coeffs &c1,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P2,
+                                            const typename policy_type::ate_ell_coeffs &c2, std::true_type) {
+
+                        return f.mul_by_01234(gt_type::value_type::mul_024_by_024(
+                            c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV,
+                            c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV));
+                    }
+
+                    static typename gt_type::value_type
+                        mul_by_line_product(const typename gt_type::value_type &f,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P1,
+                                            const typename policy_type::ate_ell_coeffs &c1,
+                                            const typename policy_type::ate_g1_precomputed_type &prec_P2,
+                                            const typename policy_type::ate_ell_coeffs &c2, std::false_type) {
+
+                        return f.mul_by_01245(gt_type::value_type::mul_045_by_045(
+                            c1.ell_0, prec_P1.PY * c1.ell_VW, prec_P1.PX * c1.ell_VV,
+                            c2.ell_0, prec_P2.PY * c2.ell_VW, prec_P2.PX * c2.ell_VV));
+                    }
+
+                public:
+                    template<typename InputIterator>
+                    static typename gt_type::value_type process(InputIterator first, InputIterator last) {
+
+                        typename gt_type::value_type f = gt_type::value_type::one();
+
+                        const typename policy_type::ate_loop_count_digits_type &digits =
+                            policy_type::ate_loop_count_digits;
+
+                        std::size_t idx = 0;
+
+                        for (long i = static_cast<long>(digits.size) - 2; i >= 0; --i) {
+                            f = f.squared();
+
+                            for (InputIterator it = first; it != last; ++it) {
+                                const typename policy_type::ate_g1_precomputed_type &prec_P = it->first;
+                                const typename policy_type::ate_ell_coeffs &c = it->second.coeffs[idx];
+
+                                if (digits.digits[i] != 0) {
+                                    f = mul_by_line_product(f, prec_P, c, prec_P, it->second.coeffs[idx + 1]);
+                                } else {
+                                    f = mul_by_line(f, prec_P, c);
+                                }
+                            }
+                            idx += (digits.digits[i] != 0) ? 2 : 1;
+                        }
+
+                        if (params_type::ate_is_loop_count_neg) {
+                            f = f.inversed();
+                        }
+
+                        if (params_type::ate_has_frobenius_lines) {
+                            for (InputIterator it = first; it != last; ++it) {
+                                f = mul_by_line_product(f, it->first, it->second.coeffs[idx], it->first,
+                                                        it->second.coeffs[idx + 1]);
+                            }
+                            idx += 2;
+                        }
+
+                        return f;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_MULTI_MILLER_LOOP_HPP
@@ -26,8 +26,9 @@
 #ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_PRECOMPUTE_G2_HPP
 #define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_ATE_PRECOMPUTE_G2_HPP
 
-#include <boost/multiprecision/number.hpp>
-#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+#include <type_traits>
+
+#include <boost/assert.hpp>
 
 #include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
 
@@ -49,31 +50,44 @@ namespace nil {
 
                     using g2_field_type_value = typename g2_type::field_type::value_type;
 
-                    static void doubling_step_for_miller_loop(const typename base_field_type::value_type &two_inv,
-                                                              typename g2_type::value_type &current,
+                    typedef std::integral_constant<bool, params_type::twist_is_d_type> twist_is_d_type;
+
+                    /* The twist xi multiplies ell_0 for a D-type twist, ell_VW for an M-type one */
+                    static void set_twisted_coeffs(const g2_field_type_value &ell_0, const g2_field_type_value &ell_VW,
+                                                   typename policy_type::ate_ell_coeffs &c, std::true_type) {
+                        c.ell_0 = params_type::twist * ell_0;
+                        c.ell_VW = ell_VW;
+                    }
+
+                    static void set_twisted_coeffs(const g2_field_type_value &ell_0, const g2_field_type_value &ell_VW,
+                                                   typename policy_type::ate_ell_coeffs &c, std::false_type) {
+                        c.ell_0 = ell_0;
+                        c.ell_VW = params_type::twist * ell_VW;
+                    }
+
+                    static void doubling_step_for_miller_loop(typename g2_type::value_type &current,
                                                               typename policy_type::ate_ell_coeffs &c) {
 
                         const g2_field_type_value X = current.X, Y = current.Y, Z = current.Z;
 
-                        const g2_field_type_value A = two_inv * (X * Y);                 // A = X1 * Y1 / 2
+                        const g2_field_type_value A = params_type::two_inv * (X * Y);    // A = X1 * Y1 / 2
                         const g2_field_type_value B = Y.squared();                       // B = Y1^2
                         const g2_field_type_value C = Z.squared();                       // C = Z1^2
-                        const g2_field_type_value D = 0x03u * C;                          // D = 3 * C
-                        const g2_field_type_value E = params_type::twist_coeff_b * D;    // E = twist_b * D
-
-                        const g2_field_type_value F = 0x03u * E;                       // F = 3 * E
-                        const g2_field_type_value G = two_inv * (B + F);              // G = (B+F)/2
-                        const g2_field_type_value H = (Y + Z).squared() - (B + C);    // H = (Y1+Z1)^2-(B+C)
-                        const g2_field_type_value I = E - B;                          // I = E-B
-                        const g2_field_type_value J = X.squared();                    // J = X1^2
-                        const g2_field_type_value E_squared = E.squared();            // E_squared = E^2
-
-                        current.X = A * (B - F);                         // X3 = A * (B-F)
-                        current.Y = G.squared() - (0x03u * E_squared);    // Y3 = G^2 - 3*E^2
-                        current.Z = B * H;                               // Z3 = B * H
-                        c.ell_0 = I;                                     // ell_0 = xi * I
-                        c.ell_VW = -params_type::twist * H;              // ell_VW = - H (later: * yP)
-                        c.ell_VV = 0x03u * J;                             // ell_VV = 3*J (later: * xP)
+                        const g2_field_type_value E = params_type::three_twist_coeff_b * C;    // E = 3 * twist_b * C
+
+                        const g2_field_type_value F = E.doubled() + E;                   // F = 3 * E
+                        const g2_field_type_value G = params_type::two_inv * (B + F);    // G = (B+F)/2
+                        const g2_field_type_value H = (Y + Z).squared() - (B + C);       // H = (Y1+Z1)^2-(B+C)
+                        const g2_field_type_value I = E - B;                             // I = E-B
+                        const g2_field_type_value J = X.squared();                       // J = X1^2
+                        const g2_field_type_value E_squared = E.squared();               // E_squared = E^2
+
+                        current.X = A * (B - F);                                        // X3 = A * (B-F)
+                        current.Y = G.squared() - (E_squared.doubled() + E_squared);    // Y3 = G^2 - 3*E^2
+                        current.Z = B * H;                                              // Z3 = B * H
+                        c.ell_VV = J.doubled() + J;    // ell_VV = 3*J (later: * xP)
+                        // D-type: ell_0 = xi * I, ell_VW = - H; M-type: ell_0 = I, ell_VW = - xi * H (later: * yP)
+                        set_twisted_coeffs(I, -H, c, twist_is_d_type());
                     }
 
                     static void mixed_addition_step_for_miller_loop(const typename g2_affine_type::value_type base,
@@ -94,9 +108,10 @@ namespace nil {
                         current.X = D * J;                     // X3 = D*J
                         current.Y = E * (I - J) - (H * Y1);    // Y3 = E*(I-J)-(H*Y1)
                         current.Z = Z1 * H;                    // Z3 = Z1*H
-                        c.ell_0 = E * x2 - D * y2;             // ell_0 = xi * (E * X2 - D * Y2)
                         c.ell_VV = -E;                         // ell_VV = - E (later: * xP)
-                        c.ell_VW = params_type::twist * D;     // ell_VW = D (later: * yP    )
+                        // D-type: ell_0 = xi * (E * X2 - D * Y2), ell_VW = D;
+                        // M-type: ell_0 = E * X2 - D * Y2, ell_VW = xi * D (later: * yP)
+                        set_twisted_coeffs(E * x2 - D * y2, D, c, twist_is_d_type());
                     }
 
                 public:
@@ -106,9 +121,6 @@ namespace nil {
 
                         typename g2_affine_type::value_type Qcopy = Q.to_affine();
 
-                        typename base_field_type::value_type two_inv =
-                            (typename base_field_type::value_type(0x02u).inversed());
-
                         g2_precomputed_type result;
                         result.QX = Qcopy.X;
                         result.QY = Qcopy.Y;
@@ -118,28 +130,43 @@ namespace nil {
                         R.Y = Qcopy.Y;
                         R.Z = g2_type::field_type::value_type::one();
 
-                        const typename policy_type::integral_type &loop_count = params_type::ate_loop_count;
+                        typename g2_affine_type::value_type minus_Q = Qcopy;
+                        minus_Q.Y = -minus_Q.Y;
+
+                        const typename policy_type::ate_loop_count_digits_type &digits =
+                            policy_type::ate_loop_count_digits;
+
+                        std::size_t idx = 0;
 
-                        bool found_one = false;
-                        typename policy_type::ate_ell_coeffs c;
+                        /* the leading digit is the starting point R = Q */
+                        for (long i = static_cast<long>(digits.size) - 2; i >= 0; --i) {
+                            doubling_step_for_miller_loop(R, result.coeffs[idx++]);
 
-                        for (long i = params_type::integral_type_max_bits; i >= 0; --i) {
-                            const bool bit = boost::multiprecision::bit_test(loop_count, i);
-                            if (!found_one) {
-                                /* this skips the MSB itself */
-                                found_one |= bit;
-                                continue;
+                            if (digits.digits[i] > 0) {
+                                mixed_addition_step_for_miller_loop(Qcopy, R, result.coeffs[idx++]);
+                            } else if (digits.digits[i] < 0) {
+                                mixed_addition_step_for_miller_loop(minus_Q, R, result.coeffs[idx++]);
                             }
+                        }
 
-                            doubling_step_for_miller_loop(two_inv, R, c);
-                            result.coeffs.push_back(c);
+                        if (params_type::ate_has_frobenius_lines) {
+                            /* Q1 = pi(Q), Q2 = -pi^2(Q) */
+                            typename g2_affine_type::value_type Q1 = Qcopy, Q2 = Qcopy;
+                            Q1.X = Qcopy.X.Frobenius_map(1) * params_type::twist_mul_by_q_X;
+                            Q1.Y = Qcopy.Y.Frobenius_map(1) * params_type::twist_mul_by_q_Y;
+                            Q2.X = Q1.X.Frobenius_map(1) * params_type::twist_mul_by_q_X;
+                            Q2.Y = -(Q1.Y.Frobenius_map(1) * params_type::twist_mul_by_q_Y);
 
-                            if (bit) {
-                                mixed_addition_step_for_miller_loop(Qcopy, R, c);
-                                result.coeffs.push_back(c);
+                            if (params_type::ate_is_loop_count_neg) {
+                                R.Y = -R.Y;
                             }
+
+                            mixed_addition_step_for_miller_loop(Q1, R, result.coeffs[idx++]);
+                            mixed_addition_step_for_miller_loop(Q2, R, result.coeffs[idx++]);
                         }
 
+                        BOOST_ASSERT(idx == result.coeffs.size());
+
                         return result;
                     }
                 };
@@ -0,0 +1,125 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_GT_EXPONENTIATION_HPP
+#define CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_GT_EXPONENTIATION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#include <boost/assert.hpp>
+#include <boost/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/pairing/detail/forms/short_weierstrass/jacobian_with_a4_0/types.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace pairing {
+
+                /** @brief Exponentiation in GT, the order r subgroup of the cyclotomic subgroup of Fp12.
+                 *  Frobenius acts on GT as exponentiation by lambda = p (mod r), so the exponent is split into
+                 *  digits e = sum e_i * |lambda|^i and elt^e = prod (elt^(|lambda|^i))^(e_i) is computed by a
+                 *  joint square-and-multiply over the short digits, with cyclotomic squarings and a table of the
+                 *  products of the Frobenius images.
+                 */
+                template<typename CurveType>
+                class short_weierstrass_jacobian_with_a4_0_gt_exponentiation {
+                    using curve_type = CurveType;
+
+                    using params_type = detail::pairing_params<curve_type>;
+
+                    using gt_value_type = typename curve_type::gt_type::value_type;
+                    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+                    using scalar_integral_type = typename params_type::scalar_integral_type;
+
+                    /// Large enough for the 4 digits of BLS12 and the 2 or 3 digits of BN exponents.
+                    constexpr static const std::size_t max_digits_count = 4;
+
+                public:
+                    /// elt must lie in GT: the decomposition relies on elt^r = 1.
+                    static gt_value_type process(const gt_value_type &elt, const scalar_value_type &exponent) {
+
+                        scalar_integral_type k = exponent.data.template convert_to<scalar_integral_type>();
+
+                        std::array<scalar_integral_type, max_digits_count> digits;
+                        std::size_t digits_count = 0;
+                        std::size_t digits_bits = 0;
+                        while (k != 0) {
+                            BOOST_ASSERT(digits_count < max_digits_count);
+                            digits[digits_count] = k % params_type::gt_frobenius_eigenvalue;
+                            k /= params_type::gt_frobenius_eigenvalue;
+                            if (digits[digits_count] != 0) {
+                                digits_bits = std::max<std::size_t>(
+                                    digits_bits, boost::multiprecision::msb(digits[digits_count]) + 1);
+                            }
+                            ++digits_count;
+                        }
+
+                        if (digits_count == 0) {
+                            return gt_value_type::one();
+                        }
+
+                        // table[mask] = prod elt^(|lambda|^i) over the bits i of mask
+                        std::array<gt_value_type, 1 << max_digits_count> table;
+                        table[0] = gt_value_type::one();
+                        gt_value_type base = elt;
+                        for (std::size_t i = 0; i < digits_count; ++i) {
+                            if (i != 0) {
+                                base = base.Frobenius_map(1);
+                                if (params_type::gt_is_frobenius_eigenvalue_neg) {
+                                    base = base.unitary_inversed();
+                                }
+                            }
+                            table[std::size_t(1) << i] = base;
+                            for (std::size_t mask = 1; mask < (std::size_t(1) << i); ++mask) {
+                                table[(std::size_t(1) << i) | mask] = table[mask] * base;
+                            }
+                        }
+
+                        gt_value_type result = gt_value_type::one();
+                        for (long j = static_cast<long>(digits_bits) - 1; j >= 0; --j) {
+                            result = result.cyclotomic_squared();
+
+                            std::size_t mask = 0;
+                            for (std::size_t i = 0; i < digits_count; ++i) {
+                                if (boost::multiprecision::bit_test(digits[i], j)) {
+                                    mask |= std::size_t(1) << i;
+                                }
+                            }
+                            if (mask != 0) {
+                                result = result * table[mask];
+                            }
+                        }
+
+                        return result;
+                    }
+                };
+            }    // namespace pairing
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+#endif    // CRYPTO3_ALGEBRA_PAIRING_SHORT_WEIERSTRASS_JACOBIAN_WITH_A4_0_GT_EXPONENTIATION_HPP
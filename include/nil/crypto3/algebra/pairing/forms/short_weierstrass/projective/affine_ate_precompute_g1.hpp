@@ -57,7 +57,7 @@ namespace nil {
                         g1_precomputed_type result;
                         result.PX = Pcopy.X;
                         result.PY = Pcopy.Y;
-                        result.PY_twist_squared = Pcopy.Y * params_type::twist.squared();
+                        result.PY_twist_squared = Pcopy.Y * params_type::twist_squared;
 
                         return result;
                     }
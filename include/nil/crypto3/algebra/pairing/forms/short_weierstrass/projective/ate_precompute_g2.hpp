@@ -117,8 +117,7 @@ namespace nil {
 
                         typename g2_affine_type::value_type Qcopy = Q.to_affine();
 
-                        g2_field_type_value twist_inv =
-                            params_type::twist.inversed();    // could add to global params if needed
+                        const g2_field_type_value &twist_inv = params_type::twist_inv;
 
                         g2_precomputed_type result;
                         result.QX = Qcopy.X;
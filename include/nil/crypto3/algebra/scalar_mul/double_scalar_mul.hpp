@@ -0,0 +1,206 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_DOUBLE_SCALAR_MUL_HPP
+#define CRYPTO3_ALGEBRA_DOUBLE_SCALAR_MUL_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <boost/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/wnaf.hpp>
+
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/wnaf.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace detail {
+                template<typename Backend, boost::multiprecision::expression_template_option ExpressionTemplates>
+                constexpr const boost::multiprecision::number<Backend, ExpressionTemplates> &
+                    scalar_to_integral(const boost::multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                    return scalar;
+                }
+
+                template<typename FieldValueType>
+                constexpr typename std::enable_if<is_field<typename FieldValueType::field_type>::value &&
+                                                      !is_extended_field<typename FieldValueType::field_type>::value,
+                                                  typename FieldValueType::field_type::integral_type>::type
+                    scalar_to_integral(const FieldValueType &scalar) {
+                    return scalar.data.template convert_to<typename FieldValueType::field_type::integral_type>();
+                }
+
+                /** @brief Whether the entries of a wNAF table of GroupValueType can be kept with Z = 1 and added
+                 *  with mixed_add: short Weierstrass groups, where the affine point (x, y) is (x : y : 1).
+                 */
+                template<typename GroupValueType>
+                struct has_affine_wnaf_table {
+                    static const bool value =
+                        has_mixed_add<GroupValueType>::value &&
+                        std::is_same<typename GroupValueType::form, curves::forms::short_weierstrass>::value;
+                };
+
+                template<typename GroupValueType>
+                typename std::enable_if<has_affine_wnaf_table<GroupValueType>::value>::type
+                    wnaf_table_to_affine(std::vector<GroupValueType> &table) {
+                    for (GroupValueType &entry : table) {
+                        if (!entry.is_zero()) {
+                            const auto entry_affine = entry.to_affine();
+                            entry = GroupValueType(entry_affine.X, entry_affine.Y);
+                        }
+                    }
+                }
+
+                template<typename GroupValueType>
+                typename std::enable_if<!has_affine_wnaf_table<GroupValueType>::value>::type
+                    wnaf_table_to_affine(std::vector<GroupValueType> &) {
+                }
+
+                /** @brief Adds the table entry selected by digit with mixed_add, the table having been passed
+                 *  through wnaf_table_to_affine.
+                 */
+                template<typename GroupValueType>
+                typename std::enable_if<has_affine_wnaf_table<GroupValueType>::value>::type
+                    wnaf_add_affine_digit(GroupValueType &result, const std::vector<GroupValueType> &table,
+                                          const long digit) {
+                    if (digit == 0) {
+                        return;
+                    }
+                    const GroupValueType entry = (digit > 0) ? table[digit / 2] : -table[(-digit) / 2];
+                    // mixed_add does not handle doubling
+                    if (result == entry) {
+                        result.double_inplace();
+                    } else {
+                        result.mixed_add(entry);
+                    }
+                }
+
+                template<typename GroupValueType>
+                typename std::enable_if<!has_affine_wnaf_table<GroupValueType>::value>::type
+                    wnaf_add_affine_digit(GroupValueType &result, const std::vector<GroupValueType> &table,
+                                          const long digit) {
+                    wnaf_add_digit(result, table, digit);
+                }
+
+                /** @brief Straus-Shamir interleaving: one doubling chain shared by both wNAF expansions.
+                 *  If AffineFirst, the entries of table_first went through wnaf_table_to_affine.
+                 */
+                template<bool AffineFirst, typename GroupValueType>
+                GroupValueType interleaved_wnaf(const std::vector<long> &naf_first,
+                                                const std::vector<GroupValueType> &table_first,
+                                                const std::vector<long> &naf_second,
+                                                const std::vector<GroupValueType> &table_second) {
+                    GroupValueType result = GroupValueType::zero();
+                    bool found_nonzero = false;
+
+                    for (long i = static_cast<long>(std::max(naf_first.size(), naf_second.size())) - 1; i >= 0; --i) {
+                        if (found_nonzero) {
+                            result.double_inplace();
+                        }
+
+                        const long digit_first = (i < static_cast<long>(naf_first.size())) ? naf_first[i] : 0;
+                        const long digit_second = (i < static_cast<long>(naf_second.size())) ? naf_second[i] : 0;
+
+                        if (AffineFirst) {
+                            wnaf_add_affine_digit(result, table_first, digit_first);
+                        } else {
+                            wnaf_add_digit(result, table_first, digit_first);
+                        }
+                        wnaf_add_digit(result, table_second, digit_second);
+                        found_nonzero = found_nonzero || digit_first != 0 || digit_second != 0;
+                    }
+
+                    return result;
+                }
+            }    // namespace detail
+
+            /** @brief Precomputed odd multiples of the generator of GroupValueType for a wide window,
+             *  built once on first use and shared by all double_scalar_mul calls with the generator.
+             *  Entries are normalized to affine form once, so that they are added with mixed_add where the
+             *  group has one.
+             */
+            template<typename GroupValueType, std::size_t WindowBits = 8>
+            struct generator_wnaf_table {
+                constexpr static const std::size_t window_bits = WindowBits;
+
+                static const std::vector<GroupValueType> &get() {
+                    static const std::vector<GroupValueType> table = make();
+                    return table;
+                }
+
+            private:
+                static std::vector<GroupValueType> make() {
+                    std::vector<GroupValueType> table = detail::wnaf_odd_multiples(window_bits, GroupValueType::one());
+                    detail::wnaf_table_to_affine(table);
+                    return table;
+                }
+            };
+
+            /** @brief Computes a * P + b * Q with interleaved wNAF, sharing the doublings of both scalars.
+             *  WindowBits is the wNAF window of both scalars.
+             *  Variable time, meant for public scalars such as in signature verification.
+             */
+            template<std::size_t WindowBits = 5, typename GroupValueType, typename FirstScalarType,
+                     typename SecondScalarType>
+            GroupValueType double_scalar_mul(const FirstScalarType &a, const GroupValueType &P,
+                                             const SecondScalarType &b, const GroupValueType &Q) {
+                const std::vector<long> naf_a =
+                    boost::multiprecision::find_wnaf(WindowBits, detail::scalar_to_integral(a));
+                const std::vector<long> naf_b =
+                    boost::multiprecision::find_wnaf(WindowBits, detail::scalar_to_integral(b));
+
+                return detail::interleaved_wnaf<false>(naf_a, detail::wnaf_odd_multiples(WindowBits, P), naf_b,
+                                                       detail::wnaf_odd_multiples(WindowBits, Q));
+            }
+
+            /** @brief Computes a * G + b * Q, G being the group generator, with interleaved wNAF.
+             *  Multiples of G come from the precomputed affine generator_wnaf_table, which allows a wider
+             *  window for G and mixed additions, odd multiples of Q are computed on the fly with a window of
+             *  WindowBits.
+             *  Variable time, meant for public scalars such as in signature verification.
+             */
+            template<std::size_t WindowBits = 5, typename GroupValueType, typename FirstScalarType,
+                     typename SecondScalarType>
+            GroupValueType double_scalar_mul(const FirstScalarType &a, const SecondScalarType &b,
+                                             const GroupValueType &Q) {
+                using generator_table_type = generator_wnaf_table<GroupValueType>;
+
+                const std::vector<long> naf_a = boost::multiprecision::find_wnaf(generator_table_type::window_bits,
+                                                                                 detail::scalar_to_integral(a));
+                const std::vector<long> naf_b =
+                    boost::multiprecision::find_wnaf(WindowBits, detail::scalar_to_integral(b));
+
+                return detail::interleaved_wnaf<true>(naf_a, generator_table_type::get(), naf_b,
+                                                      detail::wnaf_odd_multiples(WindowBits, Q));
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_DOUBLE_SCALAR_MUL_HPP
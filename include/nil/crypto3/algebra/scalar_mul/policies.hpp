@@ -0,0 +1,405 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_SCALAR_MUL_POLICIES_HPP
+#define CRYPTO3_ALGEBRA_SCALAR_MUL_POLICIES_HPP
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include <boost/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
+
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/co_z/dblu_2011_gjmrv.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/co_z/zaddc_2011_gjmrv.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/co_z/zaddu_2007_m.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective/add_2015_rcb.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/projective/dbl_2015_rcb.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/add_cached_2008_hwcd_3.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/extended_with_a_minus_1/dbl_2008_hwcd.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/twisted_edwards/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            namespace policies {
+                namespace detail {
+                    /** @brief Swaps first and second iff mask is one, mask must be zero or one.
+                     */
+                    template<typename FieldValueType>
+                    constexpr void ct_cswap(FieldValueType &first, FieldValueType &second, const FieldValueType &mask) {
+                        const FieldValueType t = mask * (first - second);
+                        first -= t;
+                        second += t;
+                    }
+
+                    /** @brief Assigns source to target iff mask is one, mask must be zero or one.
+                     */
+                    template<typename FieldValueType>
+                    constexpr void ct_cmov(FieldValueType &target, const FieldValueType &source,
+                                           const FieldValueType &mask) {
+                        target += mask * (source - target);
+                    }
+
+                    /** @brief Reduces scalar modulo the group order q and returns the n+1 low bits of the
+                     *  regularized scalar k' = k + q or k' = k + 2q, n being the bit length of q, so that bit n of
+                     *  k' is always set and the ladder runs a fixed number of iterations.
+                     */
+                    template<typename ScalarFieldType, typename Backend,
+                             boost::multiprecision::expression_template_option ExpressionTemplates>
+                    std::array<std::uint8_t, ScalarFieldType::modulus_bits + 1>
+                        regularized_scalar_bits(const boost::multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                        using integral_type = typename ScalarFieldType::integral_type;
+
+                        constexpr std::size_t n = ScalarFieldType::modulus_bits;
+                        const integral_type k = typename ScalarFieldType::value_type(scalar).data.template
+                                                convert_to<integral_type>();
+                        const integral_type q = ScalarFieldType::modulus;
+
+                        std::array<std::uint8_t, n + 1> k_plus_q {}, k_plus_2q {};
+
+                        std::uint8_t carry = 0;
+                        for (std::size_t i = 0; i < n; ++i) {
+                            const std::uint8_t s = static_cast<std::uint8_t>(boost::multiprecision::bit_test(k, i)) +
+                                                   static_cast<std::uint8_t>(boost::multiprecision::bit_test(q, i)) +
+                                                   carry;
+                            k_plus_q[i] = s & 1;
+                            carry = s >> 1;
+                        }
+                        k_plus_q[n] = carry;
+
+                        carry = 0;
+                        for (std::size_t i = 0; i <= n; ++i) {
+                            const std::uint8_t q_i =
+                                (i < n) ? static_cast<std::uint8_t>(boost::multiprecision::bit_test(q, i)) : 0;
+                            const std::uint8_t s = k_plus_q[i] + q_i + carry;
+                            k_plus_2q[i] = s & 1;
+                            carry = s >> 1;
+                        }
+
+                        // k + q >= 2^n ? k + q : k + 2q
+                        const std::uint8_t select = static_cast<std::uint8_t>(0u - k_plus_q[n]);
+                        for (std::size_t i = 0; i <= n; ++i) {
+                            k_plus_q[i] = (k_plus_q[i] & select) | (k_plus_2q[i] & ~select);
+                        }
+
+                        return k_plus_q;
+                    }
+
+                    /** @brief Group arithmetic used by the constant-time fixed-window multiplication: complete
+                     *  formulas only, so that no branch depends on the points.
+                     *  point_type is the accumulator, entry_type is the type of the precomputed table entries.
+                     */
+                    template<typename GroupValueType, typename Form = typename GroupValueType::form,
+                             typename Coordinates = typename GroupValueType::coordinates>
+                    struct ct_group_arithmetic;
+
+                    /** @brief Short Weierstrass groups (odd order), computed in projective coordinates with the
+                     *  Renes-Costello-Batina complete formulas whatever the coordinates of the group are.
+                     */
+                    template<typename GroupValueType, typename Coordinates>
+                    struct ct_group_arithmetic<GroupValueType, curves::forms::short_weierstrass, Coordinates> {
+                        using group_value_type = GroupValueType;
+                        using field_value_type = typename group_value_type::field_type::value_type;
+
+                        struct point_type {
+                            using params_type = typename group_value_type::params_type;
+                            using field_type = typename group_value_type::field_type;
+
+                            field_value_type X;
+                            field_value_type Y;
+                            field_value_type Z;
+                        };
+                        using entry_type = point_type;
+
+                        using addition_processor = curves::detail::short_weierstrass_element_g1_projective_add_2015_rcb;
+                        using doubling_processor = curves::detail::short_weierstrass_element_g1_projective_dbl_2015_rcb;
+
+                        constexpr static const bool is_jacobian =
+                            std::is_same<Coordinates, curves::coordinates::jacobian>::value ||
+                            std::is_same<Coordinates, curves::coordinates::jacobian_with_a4_0>::value ||
+                            std::is_same<Coordinates, curves::coordinates::jacobian_with_a4_minus_3>::value;
+
+                        static point_type identity() {
+                            return {field_value_type::zero(), field_value_type::one(), field_value_type::zero()};
+                        }
+
+                        static point_type from_group(const group_value_type &base) {
+                            if (base.is_zero()) {
+                                return identity();
+                            }
+                            const auto base_affine = base.to_affine();
+                            return {base_affine.X, base_affine.Y, field_value_type::one()};
+                        }
+
+                        static group_value_type to_group(const point_type &p) {
+                            if constexpr (is_jacobian) {
+                                // (X:Y:Z) projective is (XZ:YZ^2:Z) jacobian
+                                return group_value_type(p.X * p.Z, p.Y * p.Z.squared(), p.Z);
+                            } else {
+                                return group_value_type(p.X, p.Y, p.Z);
+                            }
+                        }
+
+                        static entry_type to_entry(const point_type &p) {
+                            return p;
+                        }
+
+                        static void add(point_type &p, const entry_type &e) {
+                            addition_processor::process(p, e);
+                        }
+
+                        static void dbl(point_type &p) {
+                            doubling_processor::process(p);
+                        }
+
+                        static void cmov(entry_type &target, const entry_type &source, const field_value_type &mask) {
+                            ct_cmov(target.X, source.X, mask);
+                            ct_cmov(target.Y, source.Y, mask);
+                            ct_cmov(target.Z, source.Z, mask);
+                        }
+                    };
+
+                    /** @brief Twisted Edwards groups with a = -1 and non-square d in extended coordinates, the
+                     *  unified hwcd formulas are complete there. Table entries are kept in cached form.
+                     */
+                    template<typename GroupValueType>
+                    struct ct_group_arithmetic<GroupValueType, curves::forms::twisted_edwards,
+                                               curves::coordinates::extended_with_a_minus_1> {
+                        using group_value_type = GroupValueType;
+                        using field_value_type = typename group_value_type::field_type::value_type;
+
+                        using point_type = group_value_type;
+                        using entry_type = typename group_value_type::cached_type;
+
+                        using addition_processor =
+                            curves::detail::twisted_edwards_element_g1_extended_with_a_minus_1_add_cached_2008_hwcd_3;
+                        using doubling_processor =
+                            curves::detail::twisted_edwards_element_g1_extended_with_a_minus_1_dbl_2008_hwcd;
+
+                        static point_type identity() {
+                            return point_type::zero();
+                        }
+
+                        static point_type from_group(const group_value_type &base) {
+                            return base;
+                        }
+
+                        static group_value_type to_group(const point_type &p) {
+                            return p;
+                        }
+
+                        static entry_type to_entry(const point_type &p) {
+                            return p.to_cached();
+                        }
+
+                        static void add(point_type &p, const entry_type &e) {
+                            addition_processor::process(p, e);
+                        }
+
+                        static void dbl(point_type &p) {
+                            doubling_processor::process(p);
+                        }
+
+                        static void cmov(entry_type &target, const entry_type &source, const field_value_type &mask) {
+                            ct_cmov(target.YplusX, source.YplusX, mask);
+                            ct_cmov(target.YminusX, source.YminusX, mask);
+                            ct_cmov(target.T2d, source.T2d, mask);
+                            ct_cmov(target.Z2, source.Z2, mask);
+                        }
+                    };
+                }    // namespace detail
+
+                /**
+                 * Left-to-right double-and-add, i.e. the operator * of the group.
+                 * Running time depends on the scalar, should not be used with secret scalars.
+                 */
+                struct scalar_mul_method_double_and_add {
+                    template<typename GroupValueType, typename Backend,
+                             boost::multiprecision::expression_template_option ExpressionTemplates>
+                    static inline GroupValueType
+                        process(const GroupValueType &base,
+                                const boost::multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                        return base * scalar;
+                    }
+                };
+
+                /**
+                 * Co-Z Montgomery ladder with (X,Y)-only co-Z addition formulas for short Weierstrass curves
+                 * in Jacobian coordinates (any a4). Each bit costs one conjugate co-Z addition (ZADDC) and one
+                 * co-Z addition with update (ZADDU), independently of the bit value, and the number of
+                 * iterations only depends on the group order.
+                 * See M. Rivain, "Fast and regular algorithms for scalar multiplication over elliptic curves",
+                 * https://eprint.iacr.org/2011/338, Algorithm 9.
+                 *
+                 * The base point is assumed to be public and is normalized to affine first.
+                 * The formulas are incomplete, the three scalars for which the ladder hits an exceptional case
+                 * (k = 1, -1, -2 mod q) are fixed up with constant-time selects.
+                 */
+                struct scalar_mul_method_co_z_ladder {
+                    template<typename GroupValueType, typename Backend,
+                             boost::multiprecision::expression_template_option ExpressionTemplates>
+                    static inline GroupValueType
+                        process(const GroupValueType &base,
+                                const boost::multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+
+                        using group_value_type = GroupValueType;
+                        using scalar_field_type = typename group_value_type::group_type::curve_type::scalar_field_type;
+                        using scalar_field_value_type = typename scalar_field_type::value_type;
+                        using field_value_type = typename group_value_type::field_type::value_type;
+
+                        using dblu_processor = curves::detail::short_weierstrass_element_g1_co_z_dblu_2011_gjmrv;
+                        using zaddc_processor = curves::detail::short_weierstrass_element_g1_co_z_zaddc_2011_gjmrv;
+                        using zaddu_processor = curves::detail::short_weierstrass_element_g1_co_z_zaddu_2007_m;
+
+                        if (base.is_zero()) {
+                            return group_value_type::zero();
+                        }
+
+                        const auto base_affine = base.to_affine();
+                        const group_value_type P(base_affine.X, base_affine.Y);
+
+                        const std::array<std::uint8_t, scalar_field_type::modulus_bits + 1> bits =
+                            detail::regularized_scalar_bits<scalar_field_type>(scalar);
+                        constexpr std::size_t n = scalar_field_type::modulus_bits;
+
+                        // R1 = 2P, R0 = P, the invariant R1 - R0 = P holds through the whole ladder
+                        group_value_type R0 = P;
+                        group_value_type R1 = P;
+                        dblu_processor::process(R1, R0);
+                        const group_value_type P2 = R1;
+
+                        std::uint8_t swap = 0;
+                        for (std::size_t i = n; i-- > 0;) {
+                            const std::uint8_t bit = bits[i];
+                            const field_value_type mask(static_cast<unsigned>(swap ^ bit));
+                            detail::ct_cswap(R0.X, R1.X, mask);
+                            detail::ct_cswap(R0.Y, R1.Y, mask);
+                            swap = bit;
+
+                            // (R_{1-b}, R_b) <- ZADDC(R_b, R_{1-b}), (R_b, R_{1-b}) <- ZADDU(R_{1-b}, R_b)
+                            zaddc_processor::process(R0, R1);
+                            zaddu_processor::process(R0, R1);
+                        }
+                        const field_value_type mask(static_cast<unsigned>(swap));
+                        detail::ct_cswap(R0.X, R1.X, mask);
+                        detail::ct_cswap(R0.Y, R1.Y, mask);
+
+                        // Exceptional scalars: 1 * P = P, -1 * P = -P, -2 * P = -2P
+                        const scalar_field_value_type k(scalar);
+                        const group_value_type minus_P = -P;
+                        const group_value_type minus_P2 = -P2;
+                        detail::ct_cmov(R0.X, P.X, field_value_type(static_cast<unsigned>(k.is_one())));
+                        detail::ct_cmov(R0.Y, P.Y, field_value_type(static_cast<unsigned>(k.is_one())));
+                        detail::ct_cmov(R0.Z, P.Z, field_value_type(static_cast<unsigned>(k.is_one())));
+                        const field_value_type is_minus_one(static_cast<unsigned>((k + scalar_field_value_type::one()).is_zero()));
+                        detail::ct_cmov(R0.X, minus_P.X, is_minus_one);
+                        detail::ct_cmov(R0.Y, minus_P.Y, is_minus_one);
+                        detail::ct_cmov(R0.Z, minus_P.Z, is_minus_one);
+                        const field_value_type is_minus_two(static_cast<unsigned>((k + scalar_field_value_type::one().doubled()).is_zero()));
+                        detail::ct_cmov(R0.X, minus_P2.X, is_minus_two);
+                        detail::ct_cmov(R0.Y, minus_P2.Y, is_minus_two);
+                        detail::ct_cmov(R0.Z, minus_P2.Z, is_minus_two);
+
+                        return R0;
+                    }
+                };
+                /**
+                 * Constant-time fixed-window multiplication for secret scalars. The scalar is reduced modulo
+                 * the group order q and processed in ceil(log2(q) / WindowBits) windows, each costing WindowBits
+                 * doublings, a scan of the whole table of 2^WindowBits multiples of the base with masked
+                 * selects, and one addition. Only complete formulas are used, so neither the iteration
+                 * count nor the memory access pattern nor the executed formulas depend on the scalar.
+                 *
+                 * The base point is assumed to be public and may be normalized with a variable-time inversion.
+                 */
+                template<std::size_t WindowBits = 4>
+                struct scalar_mul_method_fixed_window_ct {
+                    static_assert(WindowBits > 0 && WindowBits < 8, "window size must be in [1, 7]");
+
+                    template<typename GroupValueType, typename Backend,
+                             boost::multiprecision::expression_template_option ExpressionTemplates>
+                    static inline GroupValueType
+                        process(const GroupValueType &base,
+                                const boost::multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+
+                        using arithmetic = detail::ct_group_arithmetic<GroupValueType>;
+                        using point_type = typename arithmetic::point_type;
+                        using entry_type = typename arithmetic::entry_type;
+                        using field_value_type = typename arithmetic::field_value_type;
+                        using scalar_field_type = typename GroupValueType::group_type::curve_type::scalar_field_type;
+                        using integral_type = typename scalar_field_type::integral_type;
+
+                        constexpr std::size_t table_size = std::size_t(1) << WindowBits;
+                        constexpr std::size_t n = scalar_field_type::modulus_bits;
+                        constexpr std::size_t windows_count = (n + WindowBits - 1) / WindowBits;
+
+                        const integral_type k =
+                            typename scalar_field_type::value_type(scalar).data.template convert_to<integral_type>();
+
+                        // table[i] = i * base
+                        std::array<entry_type, table_size> table;
+                        point_type multiple = arithmetic::identity();
+                        const entry_type base_entry = arithmetic::to_entry(arithmetic::from_group(base));
+                        for (std::size_t i = 0; i < table_size; ++i) {
+                            table[i] = arithmetic::to_entry(multiple);
+                            arithmetic::add(multiple, base_entry);
+                        }
+
+                        point_type result = arithmetic::identity();
+                        for (std::size_t w = windows_count; w-- > 0;) {
+                            for (std::size_t j = 0; j < WindowBits; ++j) {
+                                arithmetic::dbl(result);
+                            }
+
+                            std::size_t digit = 0;
+                            for (std::size_t j = 0; j < WindowBits; ++j) {
+                                const std::size_t bit_index = w * WindowBits + j;
+                                if (bit_index < n) {
+                                    digit |= static_cast<std::size_t>(boost::multiprecision::bit_test(k, bit_index))
+                                             << j;
+                                }
+                            }
+
+                            entry_type selected = table[0];
+                            for (std::size_t i = 1; i < table_size; ++i) {
+                                arithmetic::cmov(selected, table[i],
+                                                 field_value_type(static_cast<unsigned>(i == digit)));
+                            }
+                            arithmetic::add(result, selected);
+                        }
+
+                        return arithmetic::to_group(result);
+                    }
+                };
+            }    // namespace policies
+        }        // namespace algebra
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_SCALAR_MUL_POLICIES_HPP
@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#ifndef CRYPTO3_ALGEBRA_SCALAR_MUL_HPP
+#define CRYPTO3_ALGEBRA_SCALAR_MUL_HPP
+
+#include <type_traits>
+
+#include <boost/multiprecision/number.hpp>
+
+#include <nil/crypto3/algebra/type_traits.hpp>
+#include <nil/crypto3/algebra/curves/forms.hpp>
+#include <nil/crypto3/algebra/curves/detail/forms/short_weierstrass/coordinates.hpp>
+#include <nil/crypto3/algebra/curves/detail/secp_k1/types.hpp>
+#include <nil/crypto3/algebra/curves/detail/secp_r1/types.hpp>
+
+#include <nil/crypto3/algebra/scalar_mul/policies.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace algebra {
+            /** @brief Scalar multiplication method to be used with secret scalars (e.g. signing nonces)
+             *  on the group GroupType, exposed as ct_scalar_mul_method<GroupType>::type.
+             *  Defaults to the complete-formulas fixed-window method.
+             */
+            template<typename GroupType>
+            struct ct_scalar_mul_method {
+                using type = policies::scalar_mul_method_fixed_window_ct<>;
+            };
+
+            template<std::size_t Version>
+            struct ct_scalar_mul_method<curves::detail::secp_k1_g1<Version, curves::forms::short_weierstrass,
+                                                                   curves::coordinates::jacobian_with_a4_0>> {
+                using type = policies::scalar_mul_method_co_z_ladder;
+            };
+
+            template<std::size_t Version>
+            struct ct_scalar_mul_method<curves::detail::secp_k1_g1<Version, curves::forms::short_weierstrass,
+                                                                   curves::coordinates::jacobian>> {
+                using type = policies::scalar_mul_method_co_z_ladder;
+            };
+
+            template<std::size_t Version>
+            struct ct_scalar_mul_method<curves::detail::secp_r1_g1<Version, curves::forms::short_weierstrass,
+                                                                   curves::coordinates::jacobian_with_a4_minus_3>> {
+                using type = policies::scalar_mul_method_co_z_ladder;
+            };
+
+            template<std::size_t Version>
+            struct ct_scalar_mul_method<curves::detail::secp_r1_g1<Version, curves::forms::short_weierstrass,
+                                                                   curves::coordinates::jacobian>> {
+                using type = policies::scalar_mul_method_co_z_ladder;
+            };
+
+            template<typename ScalarMulMethod, typename GroupValueType, typename Backend,
+                     boost::multiprecision::expression_template_option ExpressionTemplates>
+            GroupValueType scalar_mul(const GroupValueType &base,
+                                      const boost::multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                return ScalarMulMethod::process(base, scalar);
+            }
+
+            template<typename ScalarMulMethod, typename GroupValueType, typename FieldValueType>
+            typename std::enable_if<is_field<typename FieldValueType::field_type>::value &&
+                                        !is_extended_field<typename FieldValueType::field_type>::value,
+                                    GroupValueType>::type
+                scalar_mul(const GroupValueType &base, const FieldValueType &scalar) {
+                return ScalarMulMethod::process(
+                    base, scalar.data.template convert_to<typename FieldValueType::field_type::integral_type>());
+            }
+
+            /** @brief Constant-time scalar multiplication for secret scalars, the method is selected by
+             *  ct_scalar_mul_method of the group.
+             */
+            template<typename GroupValueType, typename ScalarType>
+            GroupValueType scalar_mul_ct(const GroupValueType &base, const ScalarType &scalar) {
+                using method_type = typename ct_scalar_mul_method<typename GroupValueType::group_type>::type;
+
+                return scalar_mul<method_type>(base, scalar);
+            }
+        }    // namespace algebra
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // CRYPTO3_ALGEBRA_SCALAR_MUL_HPP
@@ -25,6 +25,8 @@
 #ifndef CRYPTO3_ALGEBRA_WNAF_HPP
 #define CRYPTO3_ALGEBRA_WNAF_HPP
 
+#include <vector>
+
 #include <nil/crypto3/multiprecision/wnaf.hpp>
 
 #include <nil/crypto3/algebra/curves/params.hpp>
@@ -32,38 +34,60 @@
 namespace nil {
     namespace crypto3 {
         namespace algebra {
-            template<typename BaseValueType, typename Backend,
-                     boost::multiprecision::expression_template_option ExpressionTemplates>
-            BaseValueType fixed_window_wnaf_exp(const std::size_t window_size, const BaseValueType &base,
-                                                const boost::multiprecision::number<Backend, ExpressionTemplates> &scalar) {
-                std::vector<long> naf = boost::multiprecision::find_wnaf(window_size, scalar);
-                std::vector<BaseValueType> table(1ul << (window_size - 1));
-                BaseValueType tmp = base;
-                BaseValueType dbl = base;
-                dbl.double_inplace();
-                for (size_t i = 0; i < 1ul << (window_size - 1); ++i) {
-                    table[i] = tmp;
-                    tmp = tmp + dbl;
+            namespace detail {
+                /** @brief Odd multiples base, 3 * base, ..., (2^window_size - 1) * base, as indexed by the digits
+                 *  of find_wnaf(window_size, scalar): digit d selects table[|d| / 2].
+                 */
+                template<typename BaseValueType>
+                std::vector<BaseValueType> wnaf_odd_multiples(const std::size_t window_size,
+                                                              const BaseValueType &base) {
+                    std::vector<BaseValueType> table(1ul << (window_size - 1));
+                    BaseValueType tmp = base;
+                    BaseValueType dbl = base;
+                    dbl.double_inplace();
+                    for (size_t i = 0; i < table.size(); ++i) {
+                        table[i] = tmp;
+                        tmp = tmp + dbl;
+                    }
+                    return table;
                 }
 
-                BaseValueType res = BaseValueType::zero();
-                bool found_nonzero = false;
-                for (long i = naf.size() - 1; i >= 0; --i) {
-                    if (found_nonzero) {
-                        res.double_inplace();
+                template<typename BaseValueType>
+                void wnaf_add_digit(BaseValueType &res, const std::vector<BaseValueType> &table, const long digit) {
+                    if (digit > 0) {
+                        res = res + table[digit / 2];
+                    } else if (digit < 0) {
+                        res = res - table[(-digit) / 2];
                     }
+                }
 
-                    if (naf[i] != 0) {
-                        found_nonzero = true;
-                        if (naf[i] > 0) {
-                            res = res + table[naf[i] / 2];
-                        } else {
-                            res = res - table[(-naf[i]) / 2];
+                /** @brief Left-to-right wNAF evaluation of naf over the odd multiples in table.
+                 */
+                template<typename BaseValueType>
+                BaseValueType wnaf_exp(const std::vector<long> &naf, const std::vector<BaseValueType> &table) {
+                    BaseValueType res = BaseValueType::zero();
+                    bool found_nonzero = false;
+                    for (long i = naf.size() - 1; i >= 0; --i) {
+                        if (found_nonzero) {
+                            res.double_inplace();
+                        }
+
+                        if (naf[i] != 0) {
+                            found_nonzero = true;
+                            wnaf_add_digit(res, table, naf[i]);
                         }
                     }
+
+                    return res;
                 }
+            }    // namespace detail
 
-                return res;
+            template<typename BaseValueType, typename Backend,
+                     boost::multiprecision::expression_template_option ExpressionTemplates>
+            BaseValueType fixed_window_wnaf_exp(const std::size_t window_size, const BaseValueType &base,
+                                                const boost::multiprecision::number<Backend, ExpressionTemplates> &scalar) {
+                return detail::wnaf_exp(boost::multiprecision::find_wnaf(window_size, scalar),
+                                        detail::wnaf_odd_multiples(window_size, base));
             }
 
             // TODO: check, that CurveGroupValueType is a curve group element. Otherwise it has no wnaf_window_table
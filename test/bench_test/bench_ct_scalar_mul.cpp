@@ -0,0 +1,141 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+// dudect-style timing leakage test for constant-time scalar multiplication,
+// see O. Reparaz, J. Balasch, I. Verbauwhede, "Dude, is my code constant time?", https://eprint.iacr.org/2016/1123
+// Measurements are split in two classes (fixed scalar vs random scalars), interleaved at random,
+// and compared with Welch's t-test. |t| above ~4.5 hints at a data-dependent timing.
+
+#define BOOST_TEST_MODULE algebra_ct_scalar_mul_bench_test
+
+#include <array>
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/secp_k1.hpp>
+#include <nil/crypto3/algebra/curves/secp_r1.hpp>
+#include <nil/crypto3/algebra/curves/ed25519.hpp>
+
+#include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/scalar_mul/scalar_mul.hpp>
+
+using namespace nil::crypto3::algebra;
+
+namespace {
+    constexpr double leakage_threshold = 4.5;
+
+    /** @brief Online Welch's t-test on two classes of measurements.
+     */
+    class welch_t_test {
+        std::array<double, 2> mean = {0, 0};
+        std::array<double, 2> m2 = {0, 0};
+        std::array<std::size_t, 2> count = {0, 0};
+
+    public:
+        void push(const std::size_t cls, const double x) {
+            ++count[cls];
+            const double delta = x - mean[cls];
+            mean[cls] += delta / count[cls];
+            m2[cls] += delta * (x - mean[cls]);
+        }
+
+        double t() const {
+            const double var0 = m2[0] / (count[0] - 1);
+            const double var1 = m2[1] / (count[1] - 1);
+            return (mean[0] - mean[1]) / std::sqrt(var0 / count[0] + var1 / count[1]);
+        }
+    };
+}    // namespace
+
+template<typename CurveGroup, typename ScalarMulMethod>
+double ct_scalar_mul_leakage_test(const std::size_t measurements) {
+    using group_value_type = typename CurveGroup::value_type;
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+
+    const group_value_type base = random_element<CurveGroup>();
+    // low Hamming weight fixed class, the usual worst case for double-and-add
+    const scalar_value_type fixed_scalar = scalar_value_type::one();
+
+    std::mt19937_64 rng(std::random_device {}());
+    std::vector<std::size_t> classes(measurements);
+    std::vector<scalar_value_type> scalars(measurements);
+    for (std::size_t i = 0; i < measurements; ++i) {
+        classes[i] = rng() & 1;
+        scalars[i] = classes[i] ? random_element<scalar_field_type>() : fixed_scalar;
+    }
+
+    welch_t_test test;
+    group_value_type sink = group_value_type::zero();
+    for (std::size_t i = 0; i < measurements; ++i) {
+        auto start = std::chrono::high_resolution_clock::now();
+        group_value_type r = scalar_mul<ScalarMulMethod>(base, scalars[i]);
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now() - start);
+        sink = r;
+        test.push(classes[i], static_cast<double>(elapsed.count()));
+    }
+    BOOST_CHECK(!sink.is_zero());
+
+    return test.t();
+}
+
+template<typename CurveGroup>
+void ct_scalar_mul_leakage_test_curve(const std::string &name) {
+    using ct_method = typename ct_scalar_mul_method<CurveGroup>::type;
+
+    constexpr std::size_t measurements = 2000;
+
+    const double t_ct = ct_scalar_mul_leakage_test<CurveGroup, ct_method>(measurements);
+    const double t_plain =
+        ct_scalar_mul_leakage_test<CurveGroup, policies::scalar_mul_method_double_and_add>(measurements);
+
+    std::cout << name << " scalar_mul_ct: t = " << t_ct << std::endl;
+    std::cout << name << " double-and-add (reference, expected to leak): t = " << t_plain << std::endl;
+
+    // Timing on shared machines is noisy, report instead of failing the run
+    BOOST_WARN_LT(std::abs(t_ct), leakage_threshold);
+}
+
+BOOST_AUTO_TEST_SUITE(ct_scalar_mul_bench_tests)
+
+BOOST_AUTO_TEST_CASE(ct_scalar_mul_leakage_test_secp256k1) {
+    ct_scalar_mul_leakage_test_curve<curves::secp_k1<256>::g1_type<>>("secp256k1");
+}
+
+BOOST_AUTO_TEST_CASE(ct_scalar_mul_leakage_test_secp256r1) {
+    ct_scalar_mul_leakage_test_curve<curves::secp_r1<256>::g1_type<>>("secp256r1");
+}
+
+BOOST_AUTO_TEST_CASE(ct_scalar_mul_leakage_test_ed25519) {
+    ct_scalar_mul_leakage_test_curve<curves::ed25519::g1_type<>>("ed25519");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
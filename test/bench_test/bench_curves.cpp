@@ -51,10 +51,14 @@
 
 #include <nil/crypto3/algebra/curves/vesta.hpp>
 #include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+#include <nil/crypto3/algebra/curves/detail/clear_cofactor.hpp>
 #include <nil/crypto3/algebra/fields/fp2.hpp>
 #include <nil/crypto3/algebra/fields/fp3.hpp>
 
+#include <nil/crypto3/algebra/algorithms/hash_to_curve.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/scalar_mul/double_scalar_mul.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 
@@ -123,6 +127,241 @@ void curve_operations_perf_test() {
         << elapsed.count() / SAMPLES << " ns" << std::endl;
 }
 
+template<typename CurveType>
+void montgomery_ladder_perf_test() {
+    using namespace nil::crypto3;
+    using namespace nil::crypto3::algebra;
+
+    using affine_group_type = typename CurveType::template g1_type<curves::coordinates::affine, curves::forms::montgomery>;
+    using xz_group_type = typename CurveType::template g1_type<curves::coordinates::xz, curves::forms::montgomery>;
+    using affine_value_type = typename affine_group_type::value_type;
+    using xz_value_type = typename xz_group_type::value_type;
+    using integral_type = typename CurveType::base_field_type::integral_type;
+
+    std::vector<affine_value_type> points;
+    std::vector<integral_type> constants;
+
+    affine_value_type point = affine_value_type::one();
+    for (int i = 0; i < 100; ++i) {
+        point += point;
+        points.push_back(point);
+        std::stringstream ss;
+        ss << algebra::random_element<typename CurveType::scalar_field_type>();
+        constants.push_back(integral_type(ss.str()));
+    }
+
+    std::vector<typename affine_group_type::field_type::value_type> results_affine(points.size());
+    std::vector<typename affine_group_type::field_type::value_type> results_xz(points.size());
+
+    size_t SAMPLES = 1000;
+    std::chrono::time_point<std::chrono::high_resolution_clock> start(std::chrono::high_resolution_clock::now());
+    for (int i = 0; i < SAMPLES; ++i) {
+        int index = i % points.size();
+        results_affine[index] = (points[index] * constants[index]).X;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Affine scalar multiplication time: " << std::fixed << std::setprecision(3)
+        << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    std::vector<xz_value_type> points_xz;
+    for (const auto &p : points) {
+        points_xz.push_back(p.to_xz());
+    }
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < SAMPLES; ++i) {
+        int index = i % points.size();
+        results_xz[index] = curves::detail::montgomery_ladder(points_xz[index], constants[index]).to_affine_x();
+    }
+    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "XZ Montgomery ladder time: " << std::fixed << std::setprecision(3)
+        << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    BOOST_CHECK(results_affine == results_xz);
+}
+
+template<typename CurveGroup>
+void double_scalar_mul_perf_test() {
+    using namespace nil::crypto3;
+    using namespace nil::crypto3::algebra;
+
+    typedef typename CurveGroup::value_type value_type;
+    typedef typename CurveGroup::curve_type::scalar_field_type scalar_field_type;
+    typedef typename scalar_field_type::value_type scalar_value_type;
+
+    std::vector<value_type> points;
+    std::vector<scalar_value_type> a;
+    std::vector<scalar_value_type> b;
+
+    for (int i = 0; i < 100; ++i) {
+        points.push_back(algebra::random_element<CurveGroup>());
+        a.push_back(algebra::random_element<scalar_field_type>());
+        b.push_back(algebra::random_element<scalar_field_type>());
+    }
+
+    std::vector<value_type> results_separate(points.size());
+    std::vector<value_type> results_joint(points.size());
+    const value_type G = value_type::one();
+
+    size_t SAMPLES = 1000;
+    std::chrono::time_point<std::chrono::high_resolution_clock> start(std::chrono::high_resolution_clock::now());
+    for (int i = 0; i < SAMPLES; ++i) {
+        int index = i % points.size();
+        results_separate[index] = G * a[index] + points[index] * b[index];
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Two scalar multiplications time: " << std::fixed << std::setprecision(3)
+        << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    // warm up the generator table
+    double_scalar_mul(a[0], b[0], points[0]);
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < SAMPLES; ++i) {
+        int index = i % points.size();
+        results_joint[index] = double_scalar_mul(a[index], b[index], points[index]);
+    }
+    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Interleaved wNAF double scalar multiplication time: " << std::fixed << std::setprecision(3)
+        << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    BOOST_CHECK(results_separate == results_joint);
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < SAMPLES; ++i) {
+        int index = i % points.size();
+        results_joint[index] = double_scalar_mul(a[index], G, b[index], points[index]);
+    }
+    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Interleaved wNAF double scalar multiplication without generator table time: " << std::fixed
+        << std::setprecision(3) << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    BOOST_CHECK(results_separate == results_joint);
+}
+
+template<typename CurveGroup>
+void subgroup_check_perf_test() {
+    using namespace nil::crypto3;
+    using namespace nil::crypto3::algebra;
+
+    typedef typename CurveGroup::value_type value_type;
+
+    std::vector<value_type> points;
+    for (int i = 0; i < 100; ++i) {
+        points.push_back(algebra::random_element<CurveGroup>());
+    }
+
+    size_t SAMPLES = 1000;
+    bool result = true;
+    std::chrono::time_point<std::chrono::high_resolution_clock> start(std::chrono::high_resolution_clock::now());
+    for (int i = 0; i < SAMPLES; ++i) {
+        result &= curves::detail::subgroup_check(points[i % points.size()],
+                                                 curves::subgroup_check_methods::scalar_mul());
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Subgroup check by scalar multiplication time: " << std::fixed << std::setprecision(3)
+        << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < SAMPLES; ++i) {
+        result &= curves::detail::subgroup_check(points[i % points.size()]);
+    }
+    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Subgroup check by endomorphism time: " << std::fixed << std::setprecision(3)
+        << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    BOOST_CHECK(result);
+}
+
+template<typename CurveGroup>
+void hash_to_curve_perf_test() {
+    using namespace nil::crypto3;
+    using namespace nil::crypto3::algebra;
+
+    typedef typename CurveGroup::field_type field_type;
+    typedef typename CurveGroup::value_type value_type;
+
+    std::vector<typename field_type::value_type> us;
+    for (int i = 0; i < 100; ++i) {
+        us.push_back(algebra::random_element<field_type>());
+    }
+
+    size_t SAMPLES = 1000;
+    value_type sum = value_type::zero();
+    std::chrono::time_point<std::chrono::high_resolution_clock> start(std::chrono::high_resolution_clock::now());
+    for (int i = 0; i < SAMPLES; ++i) {
+        sum += curves::detail::map_to_curve<CurveGroup>::process(us[i % us.size()]);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Map to curve time: " << std::fixed << std::setprecision(3)
+        << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    const std::string dst = "ALGEBRA-BENCH-V01-HASH-TO-CURVE";
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < SAMPLES; ++i) {
+        sum += hash_to_curve<CurveGroup>(std::to_string(i), dst);
+    }
+    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Hash to curve time: " << std::fixed << std::setprecision(3)
+        << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    typedef typename CurveGroup::params_type::template group_type<curves::coordinates::affine>::value_type
+        affine_value_type;
+    std::vector<std::string> msgs;
+    for (int i = 0; i < SAMPLES; ++i) {
+        msgs.push_back(std::to_string(i));
+    }
+    std::vector<affine_value_type> points(SAMPLES);
+    start = std::chrono::high_resolution_clock::now();
+    batch_hash_to_curve<CurveGroup>(msgs.cbegin(), msgs.cend(), dst, points.begin());
+    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Batch hash to curve time: " << std::fixed << std::setprecision(3)
+        << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    BOOST_CHECK(sum.is_well_formed());
+    BOOST_CHECK(points.back() == hash_to_curve<CurveGroup>(msgs.back(), dst).to_affine());
+}
+
+template<typename CurveGroup>
+void clear_cofactor_perf_test() {
+    using namespace nil::crypto3;
+    using namespace nil::crypto3::algebra;
+
+    typedef typename CurveGroup::value_type value_type;
+
+    std::vector<value_type> points;
+    for (int i = 0; i < 100; ++i) {
+        points.push_back(algebra::random_element<CurveGroup>());
+    }
+
+    size_t SAMPLES = 1000;
+    value_type sum = value_type::zero();
+    std::chrono::time_point<std::chrono::high_resolution_clock> start(std::chrono::high_resolution_clock::now());
+    for (int i = 0; i < SAMPLES; ++i) {
+        sum += curves::detail::clear_cofactor(points[i % points.size()]);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - start);
+    std::cout << "Clear cofactor time: " << std::fixed << std::setprecision(3)
+        << elapsed.count() / SAMPLES << " ns" << std::endl;
+
+    BOOST_CHECK(sum.is_well_formed());
+}
+
+BOOST_AUTO_TEST_CASE(montgomery_ladder_perf_test_curve25519) {
+    montgomery_ladder_perf_test<curves::curve25519>();
+}
+
 BOOST_AUTO_TEST_CASE(curve_operations_perf_test_bls12_381_g1) {
     using policy_type = curves::bls12<381>::g1_type<>;
 
@@ -135,4 +374,60 @@ BOOST_AUTO_TEST_CASE(curve_operations_perf_test_bls12_381_g2) {
     curve_operations_perf_test<policy_type>();
 }
 
+BOOST_AUTO_TEST_CASE(subgroup_check_perf_test_bls12_381_g1) {
+    subgroup_check_perf_test<curves::bls12<381>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(subgroup_check_perf_test_bls12_381_g2) {
+    subgroup_check_perf_test<curves::bls12<381>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(subgroup_check_perf_test_alt_bn128_g2) {
+    subgroup_check_perf_test<curves::alt_bn128<254>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_perf_test_bls12_381_g1) {
+    hash_to_curve_perf_test<curves::bls12<381>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_perf_test_bls12_381_g2) {
+    hash_to_curve_perf_test<curves::bls12<381>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_perf_test_secp256k1) {
+    hash_to_curve_perf_test<curves::secp_k1<256>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_perf_test_alt_bn128_254_g1) {
+    hash_to_curve_perf_test<curves::alt_bn128<254>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_perf_test_pallas) {
+    hash_to_curve_perf_test<curves::pallas::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(hash_to_curve_perf_test_vesta) {
+    hash_to_curve_perf_test<curves::vesta::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(clear_cofactor_perf_test_bls12_381_g1) {
+    clear_cofactor_perf_test<curves::bls12<381>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(clear_cofactor_perf_test_bls12_381_g2) {
+    clear_cofactor_perf_test<curves::bls12<381>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(clear_cofactor_perf_test_alt_bn128_254_g2) {
+    clear_cofactor_perf_test<curves::alt_bn128<254>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(double_scalar_mul_perf_test_secp256k1) {
+    double_scalar_mul_perf_test<curves::secp_k1<256>::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(double_scalar_mul_perf_test_ed25519) {
+    double_scalar_mul_perf_test<curves::ed25519::g1_type<>>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
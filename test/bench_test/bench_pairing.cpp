@@ -0,0 +1,348 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2024 Mikhail Komarov <nemo@nil.foundation>
+//
+// MIT License
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//---------------------------------------------------------------------------//
+
+
+#define BOOST_TEST_MODULE algebra_pairing_bench_test
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <type_traits>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
+#include <nil/crypto3/algebra/curves/bls12.hpp>
+#include <nil/crypto3/algebra/curves/edwards.hpp>
+#include <nil/crypto3/algebra/curves/mnt4.hpp>
+#include <nil/crypto3/algebra/curves/mnt6.hpp>
+
+#include <nil/crypto3/algebra/pairing/alt_bn128.hpp>
+#include <nil/crypto3/algebra/pairing/bls12.hpp>
+#include <nil/crypto3/algebra/pairing/edwards.hpp>
+#include <nil/crypto3/algebra/pairing/mnt4.hpp>
+#include <nil/crypto3/algebra/pairing/mnt6.hpp>
+
+#include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/random_element.hpp>
+
+using namespace nil::crypto3::algebra;
+
+BOOST_AUTO_TEST_SUITE(pairing_manual_tests)
+
+template<typename Function>
+double average_time_ns(std::size_t samples, Function function) {
+    std::chrono::time_point<std::chrono::high_resolution_clock> start(std::chrono::high_resolution_clock::now());
+    for (std::size_t i = 0; i < samples; ++i) {
+        function(i);
+    }
+    auto elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+    return double(elapsed.count()) / samples;
+}
+
+/** @brief Every stage of the pairing of a policy, and the GT operations the Miller loop is made of.
+ */
+template<typename CurveType>
+void pairing_perf_test() {
+    using policy_type = pairing::pairing_policy<CurveType>;
+    using g1_type = typename CurveType::template g1_type<>;
+    using g2_type = typename CurveType::template g2_type<>;
+    using gt_value_type = typename CurveType::gt_type::value_type;
+
+    std::vector<typename g1_type::value_type> P;
+    std::vector<typename g2_type::value_type> Q;
+    for (int i = 0; i < 10; ++i) {
+        P.push_back(random_element<g1_type>());
+        Q.push_back(random_element<g2_type>());
+    }
+    std::vector<typename policy_type::g1_precomputed_type> prec_P;
+    std::vector<typename policy_type::g2_precomputed_type> prec_Q;
+    for (std::size_t i = 0; i < P.size(); ++i) {
+        prec_P.push_back(precompute_g1<CurveType>(P[i]));
+        prec_Q.push_back(precompute_g2<CurveType>(Q[i]));
+    }
+
+    const std::size_t SAMPLES = 100;
+    const std::size_t n = P.size();
+    std::vector<gt_value_type> results(n);
+
+    double elapsed = average_time_ns(SAMPLES, [&](std::size_t i) { precompute_g1<CurveType>(P[i % n]); });
+    std::cout << "G1 precomputation time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+
+    elapsed = average_time_ns(SAMPLES, [&](std::size_t i) { precompute_g2<CurveType>(Q[i % n]); });
+    std::cout << "G2 precomputation time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+
+    elapsed = average_time_ns(
+        SAMPLES, [&](std::size_t i) { results[i % n] = miller_loop<CurveType>(prec_P[i % n], prec_Q[i % n]); });
+    std::cout << "Miller loop time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+
+    elapsed = average_time_ns(SAMPLES, [&](std::size_t i) {
+        results[i % n] = double_miller_loop<CurveType>(prec_P[i % n], prec_Q[i % n], prec_P[(i + 1) % n],
+                                                       prec_Q[(i + 1) % n]);
+    });
+    std::cout << "Double Miller loop time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+
+    elapsed = average_time_ns(SAMPLES,
+                              [&](std::size_t i) { results[i % n] = final_exponentiation<CurveType>(results[i % n]); });
+    std::cout << "Final exponentiation time: " << std::fixed << std::setprecision(3) << elapsed << " ns"
+              << std::endl;
+
+    elapsed = average_time_ns(
+        SAMPLES, [&](std::size_t i) { results[i % n] = pair_reduced<CurveType>(P[i % n], Q[i % n]); });
+    std::cout << "Reduced pairing time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+
+    const std::size_t GT_SAMPLES = 10000;
+    gt_value_type f = results[0];
+    elapsed = average_time_ns(GT_SAMPLES, [&](std::size_t i) { f = f * results[i % n]; });
+    std::cout << "GT multiplication time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+
+    elapsed = average_time_ns(GT_SAMPLES, [&](std::size_t) { f = f.squared(); });
+    std::cout << "GT squaring time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+
+    BOOST_CHECK(f != gt_value_type::zero());
+}
+
+BOOST_AUTO_TEST_CASE(pairing_perf_test_bls12_381) {
+    pairing_perf_test<curves::bls12<381>>();
+}
+
+BOOST_AUTO_TEST_CASE(pairing_perf_test_bls12_377) {
+    pairing_perf_test<curves::bls12<377>>();
+}
+
+BOOST_AUTO_TEST_CASE(pairing_perf_test_alt_bn128_254) {
+    pairing_perf_test<curves::alt_bn128<254>>();
+}
+
+BOOST_AUTO_TEST_CASE(pairing_perf_test_mnt4_298) {
+    pairing_perf_test<curves::mnt4<298>>();
+}
+
+BOOST_AUTO_TEST_CASE(pairing_perf_test_mnt6_298) {
+    pairing_perf_test<curves::mnt6<298>>();
+}
+
+BOOST_AUTO_TEST_CASE(pairing_perf_test_edwards_183) {
+    pairing_perf_test<curves::edwards<183>>();
+}
+
+/** @brief Sparse products with Miller loop lines, or products of two lines, against full GT products.
+ */
+template<typename CurveType, typename SparseLine, typename SparseProduct>
+void sparse_line_perf_test(SparseLine sparse_line, SparseProduct sparse_product) {
+    using gt_type = typename CurveType::gt_type;
+    using gt_value_type = typename gt_type::value_type;
+
+    std::vector<gt_value_type> lines;
+    for (int i = 0; i < 10; ++i) {
+        lines.push_back(sparse_line(random_element<gt_type>()));
+    }
+    const std::size_t n = lines.size();
+
+    const std::size_t SAMPLES = 10000;
+    gt_value_type f = random_element<gt_type>();
+    gt_value_type g = f;
+
+    double elapsed = average_time_ns(SAMPLES, [&](std::size_t i) { f = f * lines[i % n]; });
+    std::cout << "Full line product time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+
+    elapsed = average_time_ns(SAMPLES, [&](std::size_t i) { g = sparse_product(g, lines[i % n]); });
+    std::cout << "Sparse line product time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+
+    BOOST_CHECK_EQUAL(f, g);
+}
+
+BOOST_AUTO_TEST_CASE(sparse_line_perf_test_mnt4_298) {
+    using gt_value_type = typename curves::mnt4<298>::gt_type::value_type;
+    using fp2_value_type = typename gt_value_type::underlying_type;
+
+    sparse_line_perf_test<curves::mnt4<298>>(
+        [](const gt_value_type &x) {
+            return gt_value_type(fp2_value_type(x.data[0].data[0], fp2_value_type::underlying_type::zero()),
+                                 x.data[1]);
+        },
+        [](const gt_value_type &f, const gt_value_type &line) { return f.mul_by_023(line); });
+}
+
+BOOST_AUTO_TEST_CASE(sparse_line_perf_test_mnt6_298) {
+    using gt_value_type = typename curves::mnt6<298>::gt_type::value_type;
+    using fp3_value_type = typename gt_value_type::underlying_type;
+
+    sparse_line_perf_test<curves::mnt6<298>>(
+        [](const gt_value_type &x) {
+            return gt_value_type(fp3_value_type(fp3_value_type::underlying_type::zero(),
+                                                fp3_value_type::underlying_type::zero(), x.data[0].data[2]),
+                                 x.data[1]);
+        },
+        [](const gt_value_type &f, const gt_value_type &line) { return f.mul_by_2345(line); });
+}
+
+BOOST_AUTO_TEST_CASE(sparse_line_product_perf_test_bls12_381) {
+    using gt_value_type = typename curves::bls12<381>::gt_type::value_type;
+    using fp6_value_type = typename gt_value_type::underlying_type;
+
+    // products of two M-type lines have slot 3 zero
+    sparse_line_perf_test<curves::bls12<381>>(
+        [](const gt_value_type &x) {
+            return gt_value_type(x.data[0], fp6_value_type(fp6_value_type::underlying_type::zero(),
+                                                           x.data[1].data[1], x.data[1].data[2]));
+        },
+        [](const gt_value_type &f, const gt_value_type &lines) { return f.mul_by_01245(lines); });
+}
+
+BOOST_AUTO_TEST_CASE(sparse_line_product_perf_test_alt_bn128_254) {
+    using gt_value_type = typename curves::alt_bn128<254>::gt_type::value_type;
+    using fp6_value_type = typename gt_value_type::underlying_type;
+
+    // products of two D-type lines have slot 5 zero
+    sparse_line_perf_test<curves::alt_bn128<254>>(
+        [](const gt_value_type &x) {
+            return gt_value_type(x.data[0], fp6_value_type(x.data[1].data[0], x.data[1].data[1],
+                                                           fp6_value_type::underlying_type::zero()));
+        },
+        [](const gt_value_type &f, const gt_value_type &lines) { return f.mul_by_01234(lines); });
+}
+
+/** @brief Miller loop with a fixed, precomputed G2 argument: affine lines against the policy's own lines.
+ */
+template<typename CurveType>
+void affine_miller_loop_perf_test() {
+    using policy_type = pairing::pairing_policy<CurveType>;
+    using g1_type = typename CurveType::template g1_type<>;
+    using g2_type = typename CurveType::template g2_type<>;
+    using gt_value_type = typename CurveType::gt_type::value_type;
+
+    std::vector<typename policy_type::g1_precomputed_type> prec_P;
+    for (int i = 0; i < 100; ++i) {
+        prec_P.push_back(precompute_g1<CurveType>(random_element<g1_type>()));
+    }
+    const typename g2_type::value_type Q = random_element<g2_type>();
+
+    const std::size_t SAMPLES = 100;
+    std::vector<gt_value_type> results(prec_P.size());
+
+    double elapsed = average_time_ns(SAMPLES, [&](std::size_t) { precompute_g2<CurveType>(Q); });
+    std::cout << "G2 precomputation time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+
+    elapsed = average_time_ns(SAMPLES, [&](std::size_t) { affine_precompute_g2<CurveType>(Q); });
+    std::cout << "Affine G2 precomputation time: " << std::fixed << std::setprecision(3) << elapsed << " ns"
+              << std::endl;
+
+    if constexpr (!std::is_same<typename policy_type::g2_precomputed_type,
+                                typename policy_type::affine_g2_precomputed_type>::value) {
+        const typename policy_type::g2_precomputed_type prec_Q = precompute_g2<CurveType>(Q);
+        elapsed = average_time_ns(SAMPLES, [&](std::size_t i) {
+            results[i % prec_P.size()] = miller_loop<CurveType>(prec_P[i % prec_P.size()], prec_Q);
+        });
+        std::cout << "Miller loop time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+    }
+
+    const typename policy_type::affine_g2_precomputed_type affine_prec_Q = affine_precompute_g2<CurveType>(Q);
+    elapsed = average_time_ns(SAMPLES, [&](std::size_t i) {
+        results[i % prec_P.size()] = affine_miller_loop<CurveType>(prec_P[i % prec_P.size()], affine_prec_Q);
+    });
+    std::cout << "Affine Miller loop time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+
+    BOOST_CHECK(results[0] != gt_value_type::zero());
+}
+
+BOOST_AUTO_TEST_CASE(affine_miller_loop_perf_test_bls12_381) {
+    affine_miller_loop_perf_test<curves::bls12<381>>();
+}
+
+BOOST_AUTO_TEST_CASE(affine_miller_loop_perf_test_bls12_377) {
+    affine_miller_loop_perf_test<curves::bls12<377>>();
+}
+
+BOOST_AUTO_TEST_CASE(affine_miller_loop_perf_test_alt_bn128_254) {
+    affine_miller_loop_perf_test<curves::alt_bn128<254>>();
+}
+
+BOOST_AUTO_TEST_CASE(final_exponentiation_perf_test_alt_bn128_254) {
+    using curve_type = curves::alt_bn128<254>;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+
+    std::vector<gt_value_type> elements;
+    for (int i = 0; i < 10; ++i) {
+        elements.push_back(miller_loop<curve_type>(
+            precompute_g1<curve_type>(random_element<typename curve_type::template g1_type<>>()),
+            precompute_g2<curve_type>(random_element<typename curve_type::template g2_type<>>())));
+    }
+    std::vector<gt_value_type> results(elements.size());
+
+    const std::size_t SAMPLES = 100;
+
+    double elapsed = average_time_ns(SAMPLES, [&](std::size_t i) {
+        results[i % elements.size()] = final_exponentiation<curve_type>(elements[i % elements.size()]);
+    });
+    std::cout << "Final exponentiation time: " << std::fixed << std::setprecision(3) << elapsed << " ns"
+              << std::endl;
+
+    elapsed = average_time_ns(SAMPLES / 10, [&](std::size_t i) {
+        BOOST_CHECK_EQUAL(elements[i % elements.size()].pow(pairing::detail::pairing_params<curve_type>::final_exponent),
+                          results[i % elements.size()]);
+    });
+    std::cout << "Naive final exponentiation time: " << std::fixed << std::setprecision(3) << elapsed << " ns"
+              << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(gt_exponentiation_perf_test_bls12_381) {
+    using curve_type = curves::bls12<381>;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+
+    const gt_value_type g = pair_reduced<curve_type>(random_element<typename curve_type::template g1_type<>>(),
+                                                     random_element<typename curve_type::template g2_type<>>());
+    std::vector<scalar_value_type> exponents;
+    for (int i = 0; i < 10; ++i) {
+        exponents.push_back(random_element<typename curve_type::scalar_field_type>());
+    }
+    std::vector<gt_value_type> results(exponents.size());
+
+    const std::size_t SAMPLES = 100;
+
+    double elapsed = average_time_ns(SAMPLES, [&](std::size_t i) {
+        results[i % exponents.size()] = gt_exponentiation<curve_type>(g, exponents[i % exponents.size()]);
+    });
+    std::cout << "GT exponentiation time: " << std::fixed << std::setprecision(3) << elapsed << " ns" << std::endl;
+
+    elapsed = average_time_ns(SAMPLES, [&](std::size_t i) {
+        BOOST_CHECK_EQUAL(g.pow(exponents[i % exponents.size()].data), results[i % exponents.size()]);
+    });
+    std::cout << "Naive GT exponentiation time: " << std::fixed << std::setprecision(3) << elapsed << " ns"
+              << std::endl;
+
+    typename gt_value_type::underlying_type c;
+    elapsed = average_time_ns(SAMPLES, [&](std::size_t i) { results[i % results.size()].torus_compress(c); });
+    std::cout << "GT torus compression time: " << std::fixed << std::setprecision(3) << elapsed << " ns"
+              << std::endl;
+
+    elapsed = average_time_ns(SAMPLES, [&](std::size_t) { gt_value_type::torus_decompress(c); });
+    std::cout << "GT torus decompression time: " << std::fixed << std::setprecision(3) << elapsed << " ns"
+              << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
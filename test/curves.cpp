@@ -28,6 +28,10 @@
 
 #include <iostream>
 #include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
 #include <type_traits>
 
 #include <boost/test/unit_test.hpp>
@@ -51,10 +55,18 @@
 
 #include <nil/crypto3/algebra/curves/vesta.hpp>
 #include <nil/crypto3/algebra/curves/pallas.hpp>
+#include <nil/crypto3/algebra/curves/detail/compressed_marshalling.hpp>
+#include <nil/crypto3/algebra/curves/detail/marshalling.hpp>
+#include <nil/crypto3/algebra/curves/detail/subgroup_check.hpp>
+#include <nil/crypto3/algebra/curves/detail/clear_cofactor.hpp>
 #include <nil/crypto3/algebra/fields/fp2.hpp>
 #include <nil/crypto3/algebra/fields/fp3.hpp>
 
+#include <nil/crypto3/algebra/algorithms/hash_to_curve.hpp>
+#include <nil/crypto3/algebra/mapped_point_vector.hpp>
 #include <nil/crypto3/algebra/random_element.hpp>
+#include <nil/crypto3/algebra/scalar_mul/scalar_mul.hpp>
+#include <nil/crypto3/algebra/scalar_mul/double_scalar_mul.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
@@ -194,6 +206,25 @@ void check_curve_operations_twisted_edwards(
     BOOST_CHECK_EQUAL(result, points[p2_mul_C1_plus_p2_mul_C2]);
 }
 
+template<typename CurveGroup>
+void check_cached_operations_twisted_edwards(const std::vector<typename CurveGroup::value_type> &points) {
+    using value_type = typename CurveGroup::value_type;
+
+    typename value_type::cached_type p2_cached = points[p2].to_cached();
+
+    BOOST_CHECK_EQUAL(points[p1] + p2_cached, points[p1_plus_p2]);
+    BOOST_CHECK_EQUAL(points[p1] - p2_cached, points[p1_minus_p2]);
+    BOOST_CHECK_EQUAL(points[p1] + points[p1].to_cached(), points[p1_dbl]);
+    BOOST_CHECK_EQUAL(points[p1] - points[p1].to_cached(), value_type::zero());
+    BOOST_CHECK_EQUAL(value_type::zero() + p2_cached, points[p2]);
+    BOOST_CHECK_EQUAL(points[p1] + value_type::zero().to_cached(), points[p1]);
+    BOOST_CHECK_EQUAL(-p2_cached, (-points[p2]).to_cached());
+
+    value_type result = points[p1];
+    result.mixed_add_cached(points[p2].to_affine().to_extended_with_a_minus_1().to_cached());
+    BOOST_CHECK_EQUAL(result, points[p1_plus_p2]);
+}
+
 template<typename CurveParams>
 void check_montgomery_twisted_edwards_conversion(
     const std::vector<
@@ -204,6 +235,237 @@ void check_montgomery_twisted_edwards_conversion(
                       (points[p1].to_twisted_edwards() + points[p2].to_twisted_edwards()).to_montgomery());
 }
 
+template<typename CurveParams>
+void check_montgomery_xz_ladder(
+    const std::vector<
+        curves::detail::curve_element<CurveParams, curves::forms::montgomery, curves::coordinates::affine>> &points,
+    const std::vector<typename CurveParams::field_type::integral_type> &constants) {
+    using scalar = typename CurveParams::scalar_field_type::value_type;
+
+    BOOST_CHECK_EQUAL((points[p1] * static_cast<scalar>(constants[C1])).X,
+                      (points[p1].to_xz() * static_cast<scalar>(constants[C1])).to_affine_x());
+    BOOST_CHECK_EQUAL((points[p2] * static_cast<scalar>(constants[C2])).X,
+                      (points[p2].to_xz() * static_cast<scalar>(constants[C2])).to_affine_x());
+
+    auto p1_dbl_xz = points[p1].to_xz();
+    p1_dbl_xz.double_inplace();
+    BOOST_CHECK_EQUAL(p1_dbl_xz.to_affine_x(), (points[p1] + points[p1]).X);
+
+    auto p1_plus_p2_xz = points[p1].to_xz();
+    p1_plus_p2_xz.differential_add(points[p2].to_xz(), (points[p1] - points[p2]).to_xz());
+    BOOST_CHECK_EQUAL(p1_plus_p2_xz.to_affine_x(), (points[p1] + points[p2]).X);
+}
+
+template<typename CurveGroup>
+void check_co_z_ladder() {
+    using group_value_type = typename CurveGroup::value_type;
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+    using method_type = policies::scalar_mul_method_co_z_ladder;
+
+    const group_value_type P = group_value_type::one() * random_element<scalar_field_type>();
+
+    std::vector<scalar_value_type> scalars = {scalar_value_type::zero(),
+                                              scalar_value_type::one(),
+                                              scalar_value_type::one().doubled(),
+                                              -scalar_value_type::one(),
+                                              -scalar_value_type::one().doubled(),
+                                              -scalar_value_type::one().doubled() - scalar_value_type::one()};
+    for (std::size_t i = 0; i < 16; ++i) {
+        scalars.emplace_back(random_element<scalar_field_type>());
+    }
+
+    for (const auto &k : scalars) {
+        BOOST_CHECK_EQUAL(scalar_mul<method_type>(P, k), P * k);
+        BOOST_CHECK_EQUAL(scalar_mul<method_type>(group_value_type::one(), k), group_value_type::one() * k);
+    }
+    BOOST_CHECK(scalar_mul<method_type>(group_value_type::zero(), scalars.back()).is_zero());
+}
+
+template<typename CurveGroup>
+void check_fixed_window_ct() {
+    using group_value_type = typename CurveGroup::value_type;
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+
+    const group_value_type P = group_value_type::one() * random_element<scalar_field_type>();
+
+    std::vector<scalar_value_type> scalars = {scalar_value_type::zero(), scalar_value_type::one(),
+                                              -scalar_value_type::one()};
+    for (std::size_t i = 0; i < 8; ++i) {
+        scalars.emplace_back(random_element<scalar_field_type>());
+    }
+
+    for (const auto &k : scalars) {
+        BOOST_CHECK_EQUAL(scalar_mul<policies::scalar_mul_method_fixed_window_ct<>>(P, k), P * k);
+        BOOST_CHECK_EQUAL(scalar_mul<policies::scalar_mul_method_fixed_window_ct<1>>(P, k), P * k);
+        BOOST_CHECK_EQUAL(scalar_mul<policies::scalar_mul_method_fixed_window_ct<5>>(P, k), P * k);
+        BOOST_CHECK_EQUAL(scalar_mul_ct(P, k), P * k);
+    }
+    BOOST_CHECK(scalar_mul_ct(group_value_type::zero(), scalars.back()).is_zero());
+}
+
+template<typename CurveGroup>
+void check_double_scalar_mul() {
+    using group_value_type = typename CurveGroup::value_type;
+    using scalar_field_type = typename CurveGroup::curve_type::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+
+    const group_value_type G = group_value_type::one();
+    const group_value_type Q = G * random_element<scalar_field_type>();
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        const scalar_value_type a = random_element<scalar_field_type>();
+        const scalar_value_type b = random_element<scalar_field_type>();
+
+        BOOST_CHECK_EQUAL(double_scalar_mul(a, G, b, Q), G * a + Q * b);
+        BOOST_CHECK_EQUAL(double_scalar_mul(a, b, Q), G * a + Q * b);
+        BOOST_CHECK_EQUAL(double_scalar_mul<3>(a, G, b, Q), G * a + Q * b);
+        BOOST_CHECK_EQUAL(double_scalar_mul<7>(a, b, Q), G * a + Q * b);
+    }
+    BOOST_CHECK_EQUAL(double_scalar_mul(scalar_value_type::zero(), scalar_value_type::one(), Q), Q);
+    BOOST_CHECK_EQUAL(double_scalar_mul(scalar_value_type::one(), G, -scalar_value_type::one(), G),
+                      group_value_type::zero());
+    // the affine generator table entry G is added to 2 * (G / 2)
+    const group_value_type half_G = G * scalar_value_type(2u).inversed();
+    BOOST_CHECK_EQUAL(double_scalar_mul(scalar_value_type::one(), scalar_value_type(2u), half_G), G + G);
+}
+
+template<typename CurveGroup, typename AffineCurveGroup,
+         typename Format = typename nil::marshalling::detail::default_compression_format<
+             typename AffineCurveGroup::value_type::form>::type>
+void check_compressed_point_serializer() {
+    using serializer_type = nil::marshalling::compressed_point_serializer<AffineCurveGroup, Format>;
+    using affine_value_type = typename AffineCurveGroup::value_type;
+
+    std::vector<affine_value_type> points = {affine_value_type::zero(), CurveGroup::value_type::one().to_affine()};
+    for (std::size_t i = 0; i < 6; ++i) {
+        points.push_back(random_element<CurveGroup>().to_affine());
+        points.push_back(-points.back());
+    }
+
+    std::vector<typename serializer_type::octets_type> octets(points.size());
+    std::vector<affine_value_type> decoded(points.size());
+    for (std::size_t threads_count : {1, 3}) {
+        serializer_type::batch_points_to_octets(points.begin(), points.end(), octets.begin(), threads_count);
+        BOOST_CHECK(
+            serializer_type::batch_octets_to_points(octets.begin(), octets.end(), decoded.begin(), threads_count));
+        for (std::size_t i = 0; i < points.size(); ++i) {
+            BOOST_CHECK(octets[i] == serializer_type::point_to_octets(points[i]));
+            BOOST_CHECK(decoded[i] == points[i]);
+        }
+    }
+}
+
+/// Points of the curve with the smallest x = 1, 2, ..., these are outside of the subgroup for the curves with a
+/// large cofactor
+template<typename CurveGroup>
+std::vector<typename CurveGroup::value_type> small_x_points(std::size_t count) {
+    using group_value_type = typename CurveGroup::value_type;
+    using field_value_type = typename CurveGroup::field_type::value_type;
+    using params_type = typename CurveGroup::params_type;
+
+    std::vector<group_value_type> points;
+    field_value_type x = field_value_type::zero();
+    while (points.size() < count) {
+        x = x + field_value_type::one();
+        const field_value_type y2 =
+            x.squared() * x + field_value_type(params_type::a) * x + field_value_type(params_type::b);
+        if (y2.is_square()) {
+            points.emplace_back(x, y2.sqrt(), field_value_type::one());
+        }
+    }
+    return points;
+}
+
+template<typename CurveGroup>
+void check_subgroup_check() {
+    using group_value_type = typename CurveGroup::value_type;
+
+    BOOST_CHECK(curves::detail::subgroup_check(group_value_type::zero()));
+    for (std::size_t i = 0; i < 4; ++i) {
+        const group_value_type p = random_element<CurveGroup>();
+        BOOST_CHECK(curves::detail::subgroup_check(p));
+        BOOST_CHECK(curves::detail::subgroup_check(p, curves::subgroup_check_methods::scalar_mul()));
+    }
+
+    for (const group_value_type &p : small_x_points<CurveGroup>(4)) {
+        BOOST_CHECK(p.is_well_formed());
+        BOOST_CHECK_EQUAL(curves::detail::subgroup_check(p),
+                          curves::detail::subgroup_check(p, curves::subgroup_check_methods::scalar_mul()));
+        BOOST_CHECK(!curves::detail::subgroup_check(p));
+    }
+}
+
+template<typename CurveGroup>
+void check_clear_cofactor() {
+    using group_value_type = typename CurveGroup::value_type;
+
+    BOOST_CHECK(curves::detail::clear_cofactor(group_value_type::zero()).is_zero());
+    for (const group_value_type &p : small_x_points<CurveGroup>(4)) {
+        const group_value_type q = curves::detail::clear_cofactor(p);
+        BOOST_CHECK(!q.is_zero());
+        BOOST_CHECK(q.is_well_formed());
+        BOOST_CHECK(curves::detail::subgroup_check(q, curves::subgroup_check_methods::scalar_mul()));
+    }
+}
+
+template<typename CurveGroup>
+void check_map_to_curve() {
+    using field_type = typename CurveGroup::field_type;
+    using field_value_type = typename field_type::value_type;
+    using suite_type = curves::detail::h2c_suite<CurveGroup>;
+
+    for (std::size_t i = 0; i < 8; ++i) {
+        const field_value_type u = random_element<field_type>();
+        const field_value_type v = random_element<field_type>();
+        field_value_type y;
+        if (curves::detail::sqrt_ratio<CurveGroup>::process(u, v, y)) {
+            BOOST_CHECK(y.squared() * v == u);
+        } else {
+            // y^2 * v is u times the non-square of the suite
+            BOOST_CHECK(!(u * v).is_square());
+            BOOST_CHECK(!(y.squared() * v * u).is_square());
+        }
+    }
+
+    // u = 0 takes the exceptional case of the map
+    const std::vector<field_value_type> us = {field_value_type::zero(), field_value_type::one(),
+                                              random_element<field_type>()};
+    for (const field_value_type &u : us) {
+        const typename CurveGroup::value_type p = curves::detail::map_to_curve<CurveGroup>::process(u);
+        BOOST_CHECK(!p.is_zero());
+        BOOST_CHECK(p.is_well_formed());
+        BOOST_CHECK(curves::detail::h2c<CurveGroup>::clear_cofactor(p) == p * suite_type::h_eff);
+    }
+}
+
+template<typename CurveGroup>
+void check_batch_hash_to_curve(const std::string &dst) {
+    using affine_value_type =
+        typename CurveGroup::params_type::template group_type<curves::coordinates::affine>::value_type;
+
+    const std::vector<std::string> msgs = {"", "abc", "abcdef0123456789", std::string(0x80, 'q'), "a", "b", "c"};
+    for (std::size_t threads_count : {1, 3}) {
+        std::vector<affine_value_type> points(msgs.size());
+        batch_hash_to_curve<CurveGroup>(msgs.cbegin(), msgs.cend(), dst, points.begin(), threads_count);
+        for (std::size_t i = 0; i < msgs.size(); ++i) {
+            BOOST_CHECK(points[i] == hash_to_curve<CurveGroup>(msgs[i], dst).to_affine());
+        }
+    }
+}
+
+/// RFC 9380 test vectors compare the affine coordinates of the output
+template<typename CurveGroup>
+void check_hash_to_curve(const typename CurveGroup::value_type &p,
+                         const typename CurveGroup::field_type::value_type &x,
+                         const typename CurveGroup::field_type::value_type &y) {
+    BOOST_CHECK(p.is_well_formed());
+    BOOST_CHECK(curves::detail::subgroup_check(p));
+    BOOST_CHECK(p.to_affine().X == x);
+    BOOST_CHECK(p.to_affine().Y == y);
+}
+
 template<typename FpCurveGroup, typename TestSet>
 void fp_curve_test_init(std::vector<typename FpCurveGroup::value_type> &points,
                         std::vector<std::size_t> &constants,
@@ -379,6 +641,20 @@ void curve_operation_test_twisted_edwards(
     check_curve_operations_twisted_edwards<CurveGroup>(points, constants);
 }
 
+template<typename CurveGroup, typename TestSet>
+void curve_operation_test_cached(const TestSet &test_set,
+                                 void (&test_init)(std::vector<typename CurveGroup::value_type> &,
+                                                   std::vector<typename CurveGroup::field_type::integral_type> &,
+                                                   const TestSet &)) {
+
+    std::vector<typename CurveGroup::value_type> points;
+    std::vector<typename CurveGroup::field_type::integral_type> constants;
+
+    test_init(points, constants, test_set);
+
+    check_cached_operations_twisted_edwards<CurveGroup>(points);
+}
+
 template<typename CurveGroup, typename TestSet>
 void curve_operation_test_montgomery(const TestSet &test_set,
                                      void (&test_init)(std::vector<typename CurveGroup::value_type> &,
@@ -392,6 +668,7 @@ void curve_operation_test_montgomery(const TestSet &test_set,
 
     check_curve_operations_twisted_edwards<CurveGroup>(points, constants);
     check_montgomery_twisted_edwards_conversion(points, constants);
+    check_montgomery_xz_ladder(points, constants);
 }
 
 BOOST_AUTO_TEST_SUITE(curves_manual_tests)
@@ -403,6 +680,16 @@ BOOST_DATA_TEST_CASE(curve_operation_test_jubjub_g1, string_data("curve_operatio
     curve_operation_test_twisted_edwards<policy_type>(data_set, fp_curve_twisted_edwards_test_init<policy_type>);
 }
 
+BOOST_DATA_TEST_CASE(curve_operation_test_jubjub_g1_extended_with_a_minus_1,
+                     string_data("curve_operation_test_jubjub_g1"),
+                     data_set) {
+    using policy_type = curves::jubjub::g1_type<curves::coordinates::extended_with_a_minus_1>;
+
+    curve_operation_test_twisted_edwards<policy_type>(data_set,
+                                                      fp_extended_curve_twisted_edwards_test_init<policy_type>);
+    curve_operation_test_cached<policy_type>(data_set, fp_extended_curve_twisted_edwards_test_init<policy_type>);
+}
+
 BOOST_AUTO_TEST_CASE(curve_operation_test_babyjubjub_g1) {
     using policy_type = curves::babyjubjub::g1_type<>;
     using integral_type = typename policy_type::field_type::value_type::integral_type;
@@ -481,6 +768,38 @@ BOOST_DATA_TEST_CASE(curve_operation_test_babyjubjub_montgomery_affine,
     curve_operation_test_montgomery<policy_type>(data_set, fp_curve_twisted_edwards_test_init<policy_type>);
 }
 
+BOOST_AUTO_TEST_CASE(curve_operation_test_curve25519_xz_ladder) {
+    using policy_type = curves::curve25519::g1_type<curves::coordinates::xz>;
+    using field_value_type = typename policy_type::field_type::value_type;
+    using integral_type = typename policy_type::field_type::integral_type;
+
+    // https://datatracker.ietf.org/doc/html/rfc7748#section-5.2, first test vector, with the scalar clamped and
+    // the little-endian byte strings decoded
+    const integral_type k("0x449a44ba44226a50185afcc10a4c1462dd5e46824b15163b9d7c52f06be346a0");
+    const typename policy_type::value_type u(
+        field_value_type(integral_type("0x4c1cabd0a603a9103b35b326ec2466727c5fb124a4c19435db3030586768dbe6")),
+        field_value_type::one());
+    const field_value_type expected(
+        integral_type("0x5285a2775507b454f7711c4903cfec324f088df24dea948e90c6e99d3755dac3"));
+
+    BOOST_CHECK_EQUAL(curves::detail::montgomery_ladder(u, k).to_affine_x(), expected);
+
+    using affine_policy_type = curves::curve25519::g1_type<curves::coordinates::affine>;
+    const typename affine_policy_type::value_type G = affine_policy_type::value_type::one();
+    const integral_type s("0x1db42a2b3c4d5e6f7");
+    BOOST_CHECK(G.is_well_formed());
+    BOOST_CHECK(G.to_xz().is_well_formed());
+    BOOST_CHECK_EQUAL((G * s).X, (G.to_xz() * s).to_affine_x());
+
+    // s + 2^8 * q is wider than the ladder and has to be reduced first
+    using scalar_field_type = typename curves::curve25519::scalar_field_type;
+    using extended_integral_type = typename scalar_field_type::extended_integral_type;
+    const extended_integral_type wide =
+        extended_integral_type(s) + (extended_integral_type(scalar_field_type::modulus) << 8);
+    BOOST_CHECK_GT(boost::multiprecision::msb(wide), policy_type::field_type::modulus_bits);
+    BOOST_CHECK_EQUAL((G * s).X, (G.to_xz() * wide).to_affine_x());
+}
+
 BOOST_DATA_TEST_CASE(curve_operation_test_edwards_g1, string_data("curve_operation_test_edwards_g1"), data_set) {
     using policy_type = curves::edwards<183>::g1_type<>;
 
@@ -577,6 +896,7 @@ BOOST_DATA_TEST_CASE(curve_operation_test_edwards25519, string_data("curve_opera
 
     curve_operation_test_twisted_edwards<policy_type>(data_set,
                                                       fp_extended_curve_twisted_edwards_test_init<policy_type>);
+    curve_operation_test_cached<policy_type>(data_set, fp_extended_curve_twisted_edwards_test_init<policy_type>);
 }
 
 BOOST_DATA_TEST_CASE(curve_operation_test_pallas, string_data("curve_operation_test_pallas"), data_set) {
@@ -592,4 +912,593 @@ BOOST_DATA_TEST_CASE(curve_operation_test_vesta, string_data("curve_operation_te
                                                       fp_curve_test_init<policy_type>);
 }
 
+BOOST_AUTO_TEST_CASE(curve_co_z_ladder_test) {
+    check_co_z_ladder<curves::secp_k1<256>::g1_type<>>();
+    check_co_z_ladder<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3>>();
+    check_co_z_ladder<curves::bls12<381>::g1_type<>>();
+
+    static_assert(std::is_same<typename ct_scalar_mul_method<curves::secp_k1<256>::g1_type<>>::type,
+                               policies::scalar_mul_method_co_z_ladder>::value);
+    static_assert(
+        std::is_same<typename ct_scalar_mul_method<
+                         curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3>>::type,
+                     policies::scalar_mul_method_co_z_ladder>::value);
+}
+
+BOOST_AUTO_TEST_CASE(curve_fixed_window_ct_test) {
+    check_fixed_window_ct<curves::secp_k1<256>::g1_type<>>();
+    check_fixed_window_ct<curves::secp_r1<256>::g1_type<>>();
+    check_fixed_window_ct<curves::secp_r1<256>::g1_type<curves::coordinates::jacobian_with_a4_minus_3>>();
+    check_fixed_window_ct<curves::ed25519::g1_type<>>();
+    check_fixed_window_ct<curves::bls12<381>::g1_type<>>();
+
+    static_assert(std::is_same<typename ct_scalar_mul_method<curves::ed25519::g1_type<>>::type,
+                               policies::scalar_mul_method_fixed_window_ct<>>::value);
+}
+
+BOOST_AUTO_TEST_CASE(curve_double_scalar_mul_test) {
+    check_double_scalar_mul<curves::secp_k1<256>::g1_type<>>();
+    check_double_scalar_mul<curves::secp_r1<256>::g1_type<>>();
+    check_double_scalar_mul<curves::ed25519::g1_type<>>();
+    check_double_scalar_mul<curves::bls12<381>::g1_type<>>();
+    check_double_scalar_mul<curves::bls12<381>::g2_type<>>();
+    check_double_scalar_mul<curves::alt_bn128<254>::g1_type<>>();
+    check_double_scalar_mul<curves::mnt4<298>::g1_type<>>();
+    check_double_scalar_mul<curves::pallas::g1_type<>>();
+    check_double_scalar_mul<curves::jubjub::g1_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(curve_batch_decompression_test_bls12_381) {
+    namespace validation_levels = nil::marshalling::validation_levels;
+    using curve_type = curves::bls12_381;
+    using serializer_type = nil::marshalling::curve_element_serializer<curve_type>;
+    using g1_type = curve_type::g1_type<>;
+    using g2_type = curve_type::g2_type<>;
+
+    std::vector<g1_type::value_type> g1_points = {g1_type::value_type::zero(), g1_type::value_type::one()};
+    std::vector<g2_type::value_type> g2_points = {g2_type::value_type::zero(), g2_type::value_type::one()};
+    for (int i = 0; i < 14; ++i) {
+        g1_points.push_back(random_element<g1_type>());
+        g2_points.push_back(random_element<g2_type>());
+    }
+
+    std::vector<serializer_type::compressed_g1_octets> g1_octets;
+    std::vector<serializer_type::compressed_g2_octets> g2_octets;
+    for (std::size_t i = 0; i < g1_points.size(); ++i) {
+        g1_octets.push_back(serializer_type::point_to_octets_compress(g1_points[i]));
+        g2_octets.push_back(serializer_type::point_to_octets_compress(g2_points[i]));
+    }
+
+    std::vector<curve_type::g1_type<curves::coordinates::affine>::value_type> g1_affine(g1_points.size());
+    std::vector<curve_type::g2_type<curves::coordinates::affine>::value_type> g2_affine(g2_points.size());
+    for (std::size_t threads_count : {1, 3}) {
+        BOOST_CHECK(serializer_type::batch_octets_to_g1(g1_octets.begin(), g1_octets.end(), g1_affine.begin(),
+                                                        threads_count));
+        BOOST_CHECK(serializer_type::batch_octets_to_g2(g2_octets.begin(), g2_octets.end(), g2_affine.begin(),
+                                                        threads_count));
+        for (std::size_t i = 0; i < g1_points.size(); ++i) {
+            BOOST_CHECK(g1_affine[i] == g1_points[i].to_affine());
+            BOOST_CHECK(g2_affine[i] == g2_points[i].to_affine());
+        }
+    }
+
+    // x >= p
+    std::fill(g1_octets[2].begin(), g1_octets[2].end(), 0xFF);
+    g1_octets[2][0] = 0x9F;
+    BOOST_CHECK(!serializer_type::batch_octets_to_g1(g1_octets.begin(), g1_octets.end(), g1_affine.begin()));
+    // uncompressed flags
+    g2_octets[3][0] &= 0x7F;
+    BOOST_CHECK(!serializer_type::batch_octets_to_g2(g2_octets.begin(), g2_octets.end(), g2_affine.begin()));
+    g1_octets[2] = serializer_type::point_to_octets_compress(g1_points[2]);
+    g2_octets[3] = serializer_type::point_to_octets_compress(g2_points[3]);
+
+    // x with no point of the curve, rejected whatever the validation level
+    using g1_field_value_type = g1_type::field_type::value_type;
+    using g2_field_value_type = g2_type::field_type::value_type;
+    g1_field_value_type no_point_x = g1_field_value_type::one();
+    while ((no_point_x.squared() * no_point_x + g1_field_value_type(4u)).is_square()) {
+        no_point_x = no_point_x + g1_field_value_type::one();
+    }
+    g2_field_value_type no_point_x2 = g2_field_value_type::one();
+    while ((no_point_x2.squared() * no_point_x2 + g2_field_value_type(4u, 4u)).is_square()) {
+        no_point_x2 = no_point_x2 + g2_field_value_type::one();
+    }
+    g1_octets[5] = serializer_type::point_to_octets_compress(
+        g1_type::value_type(no_point_x, g1_field_value_type::one(), g1_field_value_type::one()));
+    g2_octets[5] = serializer_type::point_to_octets_compress(
+        g2_type::value_type(no_point_x2, g2_field_value_type::one(), g2_field_value_type::one()));
+    for (std::size_t threads_count : {1, 3}) {
+        BOOST_CHECK(!serializer_type::batch_octets_to_g1(g1_octets.begin(), g1_octets.end(), g1_affine.begin(),
+                                                         threads_count));
+        BOOST_CHECK(!serializer_type::batch_octets_to_g1<validation_levels::none>(
+            g1_octets.begin(), g1_octets.end(), g1_affine.begin(), threads_count));
+        BOOST_CHECK(!serializer_type::batch_octets_to_g2(g2_octets.begin(), g2_octets.end(), g2_affine.begin(),
+                                                         threads_count));
+        BOOST_CHECK(!serializer_type::batch_octets_to_g2<validation_levels::none>(
+            g2_octets.begin(), g2_octets.end(), g2_affine.begin(), threads_count));
+    }
+    g1_octets[5] = serializer_type::point_to_octets_compress(g1_points[5]);
+    g2_octets[5] = serializer_type::point_to_octets_compress(g2_points[5]);
+
+    // infinity flag with nonzero remaining octets
+    BOOST_CHECK(serializer_type::batch_octets_to_g1(g1_octets.begin(), g1_octets.end(), g1_affine.begin()));
+    BOOST_CHECK(serializer_type::batch_octets_to_g2(g2_octets.begin(), g2_octets.end(), g2_affine.begin()));
+    g1_octets[0].back() = 0x01;
+    g2_octets[0][1] = 0x01;
+    BOOST_CHECK(!serializer_type::batch_octets_to_g1(g1_octets.begin(), g1_octets.end(), g1_affine.begin()));
+    BOOST_CHECK(!serializer_type::batch_octets_to_g2(g2_octets.begin(), g2_octets.end(), g2_affine.begin()));
+}
+
+BOOST_AUTO_TEST_CASE(curve_mapped_point_vector_test_bls12_381) {
+    using g1_type = curves::bls12<381>::g1_type<>;
+    using g1_affine_type = curves::bls12<381>::g1_type<curves::coordinates::affine>;
+    using g2_affine_type = curves::bls12<381>::g2_type<curves::coordinates::affine>;
+
+    const std::string path =
+        (std::filesystem::temp_directory_path() /
+         ("mapped_point_vector_test_bls12_381_" + std::to_string(std::random_device()()) + ".bin"))
+            .string();
+
+    std::vector<g1_affine_type::value_type> points;
+    for (int i = 0; i < 100; ++i) {
+        points.push_back(random_element<g1_type>().to_affine());
+    }
+    BOOST_CHECK(mapped_point_vector<g1_affine_type>::write(path, points.begin(), points.end()));
+
+    {
+        mapped_point_vector<g1_affine_type> mapped;
+        BOOST_CHECK(mapped.open(path, true));
+        BOOST_CHECK_EQUAL(mapped.size(), points.size());
+        BOOST_CHECK(std::equal(mapped.begin(), mapped.end(), points.begin()));
+        BOOST_CHECK_EQUAL(mapped[42], points[42]);
+        BOOST_CHECK_EQUAL(*(mapped.begin() + 42), points[42]);
+        BOOST_CHECK_EQUAL(std::size_t(std::distance(mapped.begin(), mapped.end())), points.size());
+
+        std::vector<g1_affine_type::value_type> decoded(10);
+        mapped.decode(40, decoded.size(), decoded.begin());
+        BOOST_CHECK(std::equal(decoded.begin(), decoded.end(), points.begin() + 40));
+
+        // without the checksum every point is validated
+        BOOST_CHECK(mapped.open(path));
+        BOOST_CHECK_EQUAL(mapped.size(), points.size());
+
+        // another group, another representation
+        BOOST_CHECK(!mapped_point_vector<g2_affine_type>().open(path));
+    }
+
+    const auto tamper = [&path](std::streamoff offset, char mask) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekg(offset);
+        const char octet = file.get();
+        file.seekp(offset);
+        file.put(char(octet ^ mask));
+    };
+    mapped_point_vector<g1_affine_type> mapped;
+
+    // a point off the curve
+    const std::streamoff x_offset = mapped_point_vector<g1_affine_type>::header_size;
+    tamper(x_offset + 5, 1);
+    BOOST_CHECK(!mapped.open(path));
+    BOOST_CHECK(!mapped.open(path, true));
+    tamper(x_offset + 5, 1);
+    BOOST_CHECK(mapped.open(path));
+
+    // a coordinate that is not reduced: on a little-endian machine the last octet of X is its top one
+    const std::streamoff x_last = x_offset + mapped_point_vector<g1_affine_type>::element_size / 2 - 1;
+    tamper(x_last, char(0xFF));
+    BOOST_CHECK(!mapped.open(path));
+
+    BOOST_CHECK(!mapped.open(path + ".missing"));
+    std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(curve_compressed_point_serializer_test) {
+    using nil::marshalling::compressed_point_serializer;
+    using curves::coordinates::affine;
+    namespace compression_formats = nil::marshalling::compression_formats;
+
+    check_compressed_point_serializer<curves::secp_k1<256>::g1_type<>, curves::secp_k1<256>::g1_type<affine>>();
+    check_compressed_point_serializer<curves::alt_bn128<254>::g1_type<>, curves::alt_bn128<254>::g1_type<affine>>();
+    check_compressed_point_serializer<curves::alt_bn128<254>::g2_type<>, curves::alt_bn128<254>::g2_type<affine>>();
+    check_compressed_point_serializer<curves::mnt6<298>::g2_type<>, curves::mnt6<298>::g2_type<affine>>();
+    check_compressed_point_serializer<curves::pallas::g1_type<>, curves::pallas::g1_type<affine>,
+                                      compression_formats::little_endian_sign>();
+    check_compressed_point_serializer<curves::vesta::g1_type<>, curves::vesta::g1_type<affine>,
+                                      compression_formats::little_endian_sign>();
+    check_compressed_point_serializer<curves::bls12<381>::g1_type<>, curves::bls12<381>::g1_type<affine>,
+                                      compression_formats::zcash>();
+    check_compressed_point_serializer<curves::bls12<381>::g2_type<>, curves::bls12<381>::g2_type<affine>,
+                                      compression_formats::zcash>();
+    check_compressed_point_serializer<curves::ed25519::g1_type<>, curves::ed25519::g1_type<affine>>();
+    check_compressed_point_serializer<curves::jubjub::g1_type<>, curves::jubjub::g1_type<affine>>();
+
+    // SEC1 2.3.3: 02 79BE667E...
+    using secp256k1_serializer = compressed_point_serializer<curves::secp_k1<256>::g1_type<affine>>;
+    secp256k1_serializer::octets_type secp256k1_octets =
+        secp256k1_serializer::point_to_octets(curves::secp_k1<256>::g1_type<affine>::value_type::one());
+    BOOST_CHECK_EQUAL(secp256k1_octets.size(), 33);
+    BOOST_CHECK_EQUAL(secp256k1_octets[0], 0x02);
+    BOOST_CHECK_EQUAL(secp256k1_octets[1], 0x79);
+    BOOST_CHECK_EQUAL(secp256k1_octets[32], 0x98);
+
+    // RFC 8032 base point: 58666666...66
+    using ed25519_serializer = compressed_point_serializer<curves::ed25519::g1_type<affine>>;
+    const ed25519_serializer::octets_type ed25519_octets =
+        ed25519_serializer::point_to_octets(curves::ed25519::g1_type<>::value_type::one().to_affine());
+    BOOST_CHECK_EQUAL(ed25519_octets[0], 0x58);
+    BOOST_CHECK(std::all_of(ed25519_octets.begin() + 1, ed25519_octets.end(),
+                            [](std::uint8_t octet) { return octet == 0x66; }));
+
+    // same octets as curve_element_serializer
+    using bls12_381_serializer =
+        compressed_point_serializer<curves::bls12<381>::g2_type<affine>, compression_formats::zcash>;
+    const curves::bls12<381>::g2_type<>::value_type bls12_381_point = random_element<curves::bls12<381>::g2_type<>>();
+    const auto zcash_octets =
+        nil::marshalling::curve_element_serializer<curves::bls12_381>::point_to_octets_compress(bls12_381_point);
+    const bls12_381_serializer::octets_type bls12_381_octets =
+        bls12_381_serializer::point_to_octets(bls12_381_point.to_affine());
+    BOOST_CHECK(std::equal(zcash_octets.begin(), zcash_octets.end(), bls12_381_octets.begin()));
+
+    // non-canonical or malformed encodings
+    curves::secp_k1<256>::g1_type<affine>::value_type secp256k1_point;
+    std::fill(secp256k1_octets.begin() + 1, secp256k1_octets.end(), 0xFF);
+    BOOST_CHECK(!secp256k1_serializer::octets_to_point(secp256k1_octets, secp256k1_point));
+    const curves::secp_k1<256>::g1_type<affine>::value_type secp256k1_two =
+        curves::secp_k1<256>::g1_type<affine>::value_type::one() +
+        curves::secp_k1<256>::g1_type<affine>::value_type::one();
+    BOOST_CHECK(secp256k1_serializer::octets_to_point(secp256k1_serializer::point_to_octets(secp256k1_two),
+                                                      secp256k1_point));
+    BOOST_CHECK_EQUAL(secp256k1_point, secp256k1_two);
+    secp256k1_octets = secp256k1_serializer::point_to_octets(secp256k1_point);
+    secp256k1_octets[0] = 0x04;
+    BOOST_CHECK(!secp256k1_serializer::octets_to_point(secp256k1_octets, secp256k1_point));
+    BOOST_CHECK_EQUAL(secp256k1_point, secp256k1_two);
+
+    using pallas_serializer =
+        compressed_point_serializer<curves::pallas::g1_type<affine>, compression_formats::little_endian_sign>;
+    pallas_serializer::octets_type pallas_octets;
+    std::fill(pallas_octets.begin(), pallas_octets.end(), 0xFF);
+    pallas_octets.back() = 0x7F;
+    curves::pallas::g1_type<affine>::value_type pallas_point;
+    BOOST_CHECK(!pallas_serializer::octets_to_point(pallas_octets, pallas_point));
+
+    // x = 0 with the sign of x set
+    ed25519_serializer::octets_type ed25519_identity =
+        ed25519_serializer::point_to_octets(curves::ed25519::g1_type<affine>::value_type::zero());
+    curves::ed25519::g1_type<affine>::value_type ed25519_point;
+    BOOST_CHECK(ed25519_serializer::octets_to_point(ed25519_identity, ed25519_point));
+    BOOST_CHECK(ed25519_point.is_zero());
+    ed25519_identity.back() |= 0x80;
+    BOOST_CHECK(!ed25519_serializer::octets_to_point(ed25519_identity, ed25519_point));
+}
+
+BOOST_AUTO_TEST_CASE(curve_validation_levels_test_bls12_381) {
+    using nil::marshalling::compressed_point_serializer;
+    using nil::marshalling::curve_element_serializer;
+    namespace validation_levels = nil::marshalling::validation_levels;
+    using curve_type = curves::bls12_381;
+    using serializer_type = curve_element_serializer<curve_type>;
+    using g1_type = curve_type::g1_type<>;
+    using g2_type = curve_type::g2_type<>;
+    using g1_affine_value_type = curve_type::g1_type<curves::coordinates::affine>::value_type;
+    using g2_affine_value_type = curve_type::g2_type<curves::coordinates::affine>::value_type;
+    using field_value_type = g1_type::field_type::value_type;
+
+    // a point of E(Fp) outside of G1
+    field_value_type x = field_value_type::one(), y2 = x.squared() * x + field_value_type(4u);
+    while (!y2.is_square()) {
+        x = x + field_value_type::one();
+        y2 = x.squared() * x + field_value_type(4u);
+    }
+    const g1_type::value_type outside(x, y2.sqrt(), field_value_type::one());
+    BOOST_CHECK(!curves::detail::subgroup_check(outside));
+
+    std::vector<g1_type::value_type> g1_points = {g1_type::value_type::zero(), outside};
+    std::vector<g2_type::value_type> g2_points = {g2_type::value_type::zero()};
+    for (int i = 0; i < 6; ++i) {
+        g1_points.push_back(random_element<g1_type>());
+        g2_points.push_back(random_element<g2_type>());
+    }
+
+    std::vector<serializer_type::uncompressed_g1_octets> g1_octets;
+    std::vector<serializer_type::compressed_g1_octets> g1_compressed_octets;
+    std::vector<serializer_type::uncompressed_g2_octets> g2_octets;
+    for (const auto &point : g1_points) {
+        g1_octets.push_back(serializer_type::point_to_octets(point));
+        g1_compressed_octets.push_back(serializer_type::point_to_octets_compress(point));
+    }
+    for (const auto &point : g2_points) {
+        g2_octets.push_back(serializer_type::point_to_octets(point));
+    }
+
+    std::vector<g1_affine_value_type> g1_affine(g1_points.size());
+    std::vector<g2_affine_value_type> g2_affine(g2_points.size());
+    for (std::size_t threads_count : {1, 3}) {
+        BOOST_CHECK(serializer_type::batch_uncompressed_octets_to_g1<validation_levels::none>(
+            g1_octets.begin(), g1_octets.end(), g1_affine.begin(), threads_count));
+        BOOST_CHECK(serializer_type::batch_uncompressed_octets_to_g1(g1_octets.begin(), g1_octets.end(),
+                                                                     g1_affine.begin(), threads_count));
+        for (std::size_t i = 0; i < g1_points.size(); ++i) {
+            BOOST_CHECK(g1_affine[i] == g1_points[i].to_affine());
+        }
+        BOOST_CHECK(!serializer_type::batch_uncompressed_octets_to_g1<validation_levels::subgroup>(
+            g1_octets.begin(), g1_octets.end(), g1_affine.begin(), threads_count));
+        BOOST_CHECK(serializer_type::batch_uncompressed_octets_to_g1<validation_levels::subgroup>(
+            g1_octets.begin() + 2, g1_octets.end(), g1_affine.begin(), threads_count));
+
+        BOOST_CHECK(serializer_type::batch_octets_to_g1(g1_compressed_octets.begin(), g1_compressed_octets.end(),
+                                                        g1_affine.begin(), threads_count));
+        BOOST_CHECK(!serializer_type::batch_octets_to_g1<validation_levels::subgroup>(
+            g1_compressed_octets.begin(), g1_compressed_octets.end(), g1_affine.begin(), threads_count));
+
+        BOOST_CHECK(serializer_type::batch_uncompressed_octets_to_g2<validation_levels::subgroup>(
+            g2_octets.begin(), g2_octets.end(), g2_affine.begin(), threads_count));
+        for (std::size_t i = 0; i < g2_points.size(); ++i) {
+            BOOST_CHECK(g2_affine[i] == g2_points[i].to_affine());
+        }
+    }
+
+    // y + 1 is not on the curve, which only the unchecked path accepts
+    serializer_type::uncompressed_g1_octets off_curve = g1_octets[2];
+    off_curve.back() ^= 1;
+    BOOST_CHECK(serializer_type::batch_uncompressed_octets_to_g1<validation_levels::none>(
+        &off_curve, &off_curve + 1, g1_affine.begin()));
+    BOOST_CHECK(
+        !serializer_type::batch_uncompressed_octets_to_g1(&off_curve, &off_curve + 1, g1_affine.begin()));
+
+    // The single point decoders reject an x with no point of the curve whatever the level, and check
+    // the level on the decoded point
+    using g2_field_value_type = g2_type::field_type::value_type;
+    field_value_type no_point_x = field_value_type::one();
+    while ((no_point_x.squared() * no_point_x + field_value_type(4u)).is_square()) {
+        no_point_x = no_point_x + field_value_type::one();
+    }
+    g2_field_value_type no_point_x2 = g2_field_value_type::one();
+    while ((no_point_x2.squared() * no_point_x2 + g2_field_value_type(4u, 4u)).is_square()) {
+        no_point_x2 = no_point_x2 + g2_field_value_type::one();
+    }
+    const serializer_type::compressed_g1_octets no_point_octets = serializer_type::point_to_octets_compress(
+        g1_type::value_type(no_point_x, field_value_type::one(), field_value_type::one()));
+    const serializer_type::compressed_g2_octets no_point_octets2 = serializer_type::point_to_octets_compress(
+        g2_type::value_type(no_point_x2, g2_field_value_type::one(), g2_field_value_type::one()));
+
+    g1_type::value_type g1_point;
+    g2_type::value_type g2_point;
+    BOOST_CHECK(!serializer_type::octets_to_g1_point(no_point_octets, g1_point));
+    BOOST_CHECK(!serializer_type::octets_to_g1_point<validation_levels::none>(no_point_octets, g1_point));
+    BOOST_CHECK(!serializer_type::octets_to_g2_point(no_point_octets2, g2_point));
+    BOOST_CHECK(!serializer_type::octets_to_g2_point<validation_levels::none>(no_point_octets2, g2_point));
+    BOOST_CHECK(!serializer_type::octets_to_g1_point(off_curve, g1_point));
+
+    BOOST_CHECK(serializer_type::octets_to_g1_point(g1_compressed_octets[1], g1_point));
+    BOOST_CHECK(g1_point == outside);
+    BOOST_CHECK(serializer_type::octets_to_g1_point(g1_octets[1], g1_point));
+    BOOST_CHECK(g1_point == outside);
+    BOOST_CHECK(
+        !serializer_type::octets_to_g1_point<validation_levels::subgroup>(g1_compressed_octets[1], g1_point));
+    BOOST_CHECK(!serializer_type::octets_to_g1_point<validation_levels::subgroup>(g1_octets[1], g1_point));
+    BOOST_CHECK(serializer_type::octets_to_g1_point<validation_levels::subgroup>(g1_compressed_octets[2], g1_point));
+    BOOST_CHECK(g1_point == g1_points[2]);
+    BOOST_CHECK(serializer_type::octets_to_g2_point<validation_levels::subgroup>(
+        serializer_type::point_to_octets_compress(g2_points[1]), g2_point));
+    BOOST_CHECK(g2_point == g2_points[1]);
+    BOOST_CHECK(serializer_type::octets_to_g2_point<validation_levels::subgroup>(g2_octets[1], g2_point));
+    BOOST_CHECK(g2_point == g2_points[1]);
+
+    // (0, -1) has order 2 on jubjub
+    using jubjub_affine_type = curves::jubjub::g1_type<curves::coordinates::affine>;
+    using jubjub_serializer = compressed_point_serializer<jubjub_affine_type>;
+    const jubjub_serializer::octets_type order_two_octets = jubjub_serializer::point_to_octets(
+        jubjub_affine_type::value_type(jubjub_affine_type::field_type::value_type::zero(),
+                                       -jubjub_affine_type::field_type::value_type::one()));
+    jubjub_affine_type::value_type jubjub_point;
+    BOOST_CHECK(jubjub_serializer::octets_to_point(order_two_octets, jubjub_point));
+    BOOST_CHECK(!jubjub_serializer::octets_to_point<validation_levels::subgroup>(order_two_octets, jubjub_point));
+    BOOST_CHECK(jubjub_serializer::octets_to_point<validation_levels::subgroup>(
+        jubjub_serializer::point_to_octets(jubjub_affine_type::value_type::one()), jubjub_point));
+}
+
+BOOST_AUTO_TEST_CASE(curve_subgroup_check_test) {
+    using curves::coordinates::projective;
+
+    static_assert(std::is_same<curves::detail::subgroup_check_method<curves::bls12<381>::g1_type<>>::type,
+                               curves::subgroup_check_methods::sigma_endomorphism>::value);
+    static_assert(std::is_same<curves::detail::subgroup_check_method<curves::bls12<381>::g2_type<>>::type,
+                               curves::subgroup_check_methods::psi_endomorphism>::value);
+    static_assert(std::is_same<curves::detail::subgroup_check_method<curves::alt_bn128<254>::g2_type<>>::type,
+                               curves::subgroup_check_methods::psi_endomorphism>::value);
+    static_assert(std::is_same<curves::detail::subgroup_check_method<curves::alt_bn128<254>::g1_type<>>::type,
+                               curves::subgroup_check_methods::scalar_mul>::value);
+
+    check_subgroup_check<curves::bls12<381>::g1_type<>>();
+    check_subgroup_check<curves::bls12<381>::g1_type<projective>>();
+    check_subgroup_check<curves::bls12<381>::g2_type<>>();
+    check_subgroup_check<curves::bls12<381>::g2_type<projective>>();
+    check_subgroup_check<curves::alt_bn128<254>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(curve_clear_cofactor_test) {
+    check_clear_cofactor<curves::bls12<381>::g1_type<>>();
+    check_clear_cofactor<curves::bls12<381>::g2_type<>>();
+    check_clear_cofactor<curves::bls12<381>::g2_type<projective>>();
+    check_clear_cofactor<curves::alt_bn128<254>::g2_type<>>();
+}
+
+BOOST_AUTO_TEST_CASE(curve_hash_to_curve_test_bls12_381) {
+    using g1_type = curves::bls12<381>::g1_type<>;
+    using g2_type = curves::bls12<381>::g2_type<>;
+    using g1_field_value_type = g1_type::field_type::value_type;
+    using g2_field_value_type = g2_type::field_type::value_type;
+    using expander_type = curves::detail::expand_message_xmd<curves::detail::sha2_256>;
+
+    check_map_to_curve<g1_type>();
+    check_map_to_curve<g2_type>();
+
+    // RFC 9380 K.1
+    const std::string expander_dst = "QUUX-V01-CS02-with-expander-SHA256-128";
+    BOOST_CHECK(expander_type::process(std::string(""), expander_dst, 0x20) ==
+                std::vector<std::uint8_t>({0x68, 0xa9, 0x85, 0xb8, 0x7e, 0xb6, 0xb4, 0x69, 0x52, 0x12, 0x89, 0x11,
+                                          0xf2, 0xa4, 0x41, 0x2b, 0xbc, 0x30, 0x2a, 0x9d, 0x75, 0x96, 0x67, 0xf8,
+                                          0x7f, 0x7a, 0x21, 0xd8, 0x03, 0xf0, 0x72, 0x35}));
+    BOOST_CHECK(expander_type::process(std::string("abc"), expander_dst, 0x20) ==
+                std::vector<std::uint8_t>({0xd8, 0xcc, 0xab, 0x23, 0xb5, 0x98, 0x5c, 0xce, 0xa8, 0x65, 0xc6, 0xc9,
+                                          0x7b, 0x6e, 0x5b, 0x83, 0x50, 0xe7, 0x94, 0xe6, 0x03, 0xb4, 0xb9, 0x79,
+                                          0x02, 0xf5, 0x3a, 0x8a, 0x0d, 0x60, 0x56, 0x15}));
+
+    // RFC 9380 J.9.1
+    const std::string g1_ro_dst = "QUUX-V01-CS02-with-BLS12381G1_XMD:SHA-256_SSWU_RO_";
+    check_hash_to_curve<g1_type>(
+        hash_to_curve<g1_type>(std::string(""), g1_ro_dst),
+        g1_field_value_type(0x52926ADD2207B76CA4FA57A8734416C8DC95E24501772C814278700EED6D1E4E8CF62D9C09DB0FAC349612B759E79A1_cppui_modular379),
+        g1_field_value_type(0x8BA738453BFED09CB546DBB0783DBB3A5F1F566ED67BB6BE0E8C67E2E81A4CC68EE29813BB7994998F3EAE0C9C6A265_cppui_modular380));
+    check_hash_to_curve<g1_type>(
+        hash_to_curve<g1_type>(std::string("abc"), g1_ro_dst),
+        g1_field_value_type(0x3567BC5EF9C690C2AB2ECDF6A96EF1C139CC0B2F284DCA0A9A7943388A49A3AEE664BA5379A7655D3C68900BE2F6903_cppui_modular378),
+        g1_field_value_type(0xB9C15F3FE6E5CF4211F346271D7B01C8F3B28BE689C8429C85B67AF215533311F0B8DFAAA154FA6B88176C229F2885D_cppui_modular380));
+
+    // RFC 9380 J.9.2
+    check_hash_to_curve<g1_type>(
+        encode_to_curve<g1_type>(std::string("abc"), std::string("QUUX-V01-CS02-with-BLS12381G1_XMD:SHA-256_SSWU_NU_")),
+        g1_field_value_type(0x9769F3AB59BFD551D53A5F846B9984C59B97D6842B20A2C565BAA167945E3D026A3755B6345DF8EC7E6ACB6868AE6D_cppui_modular376),
+        g1_field_value_type(0x1532C00CF61AA3D0CE3E5AA20C3B531A2ABD2C770A790A2613818303C6B830FFC0ECF6C357AF3317B9575C567F11CD2C_cppui_modular381));
+
+    // RFC 9380 J.10.1
+    const std::string g2_ro_dst = "QUUX-V01-CS02-with-BLS12381G2_XMD:SHA-256_SSWU_RO_";
+    check_hash_to_curve<g2_type>(
+        hash_to_curve<g2_type>(std::string(""), g2_ro_dst),
+        g2_field_value_type(0x141EBFBDCA40EB85B87142E130AB689C673CF60F1A3E98D69335266F30D9B8D4AC44C1038E9DCDD5393FAF5C41FB78A_cppui_modular377,
+                            0x5CB8437535E20ECFFAEF7752BADDF98034139C38452458BAEEFAB379BA13DFF5BF5DD71B72418717047F5B0F37DA03D_cppui_modular379),
+        g2_field_value_type(0x503921D7F6A12805E72940B963C0CF3471C7B2A524950CA195D11062EE75EC076DAF2D4BC358C4B190C0C98064FDD92_cppui_modular379,
+                            0x12424AC32561493F3FE3C260708A12B7C620E7BE00099A974E259DDC7D1F6395C3C811CDD19F1E8DBF3E9ECFDCBAB8D6_cppui_modular381));
+    check_hash_to_curve<g2_type>(
+        hash_to_curve<g2_type>(std::string("abc"), g2_ro_dst),
+        g2_field_value_type(0x2C2D18E033B960562AAE3CAB37A27CE00D80CCD5BA4B7FE0E7A210245129DBEC7780CCC7954725F4168AFF2787776E6_cppui_modular378,
+                            0x139CDDBCCDC5E91B9623EFD38C49F81A6F83F175E80B06FC374DE9EB4B41DFE4CA3A230ED250FBE3A2ACF73A41177FD8_cppui_modular381),
+        g2_field_value_type(0x1787327B68159716A37440985269CF584BCB1E621D3A7202BE6EA05C4CFE244AEB197642555A0645FB87BF7466B2BA48_cppui_modular381,
+                            0xAA65DAE3C8D732D10ECD2C50F8A1BAF3001578F71C694E03866E9F3D49AC1E1CE70DD94A733534F106D4CEC0EDDD16_cppui_modular376));
+
+    // RFC 9380 J.10.2
+    check_hash_to_curve<g2_type>(
+        encode_to_curve<g2_type>(std::string("abc"), std::string("QUUX-V01-CS02-with-BLS12381G2_XMD:SHA-256_SSWU_NU_")),
+        g2_field_value_type(0x108ED59FD9FAE381ABFD1D6BCE2FD2FA220990F0F837FA30E0F27914ED6E1454DB0D1EE957B219F61DA6FF8BE0D6441F_cppui_modular381,
+                            0x296238EA82C6D4ADB3C838EE3CB2346049C90B96D602D7BB1B469B905C9228BE25C627BFFEE872DEF773D5B2A2EB57D_cppui_modular378),
+        g2_field_value_type(0x33F90F6057AADACAE7963B0A0B379DD46750C1C94A6357C99B65F63B79E321FF50FE3053330911C56B6CEEA08FEE656_cppui_modular378,
+                            0x153606C417E59FB331B7AE6BCE4FBF7C5190C33CE9402B5EBE2B70E44FCA614F3F1382A3625ED5493843D0B0A652FC3F_cppui_modular381));
+
+    check_batch_hash_to_curve<g1_type>(g1_ro_dst);
+    check_batch_hash_to_curve<g2_type>(g2_ro_dst);
+}
+
+BOOST_AUTO_TEST_CASE(curve_hash_to_curve_test_other_curves) {
+    using secp256k1_type = curves::secp_k1<256>::g1_type<>;
+    using bn254_type = curves::alt_bn128<254>::g1_type<>;
+    using pallas_type = curves::pallas::g1_type<>;
+    using vesta_type = curves::vesta::g1_type<>;
+    using secp256k1_field_value_type = secp256k1_type::field_type::value_type;
+    using bn254_field_value_type = bn254_type::field_type::value_type;
+    using pallas_field_value_type = pallas_type::field_type::value_type;
+    using vesta_field_value_type = vesta_type::field_type::value_type;
+
+    check_map_to_curve<secp256k1_type>();
+    check_map_to_curve<bn254_type>();
+    check_map_to_curve<pallas_type>();
+    check_map_to_curve<vesta_type>();
+
+    // RFC 9380 J.8.1
+    const std::string secp256k1_ro_dst = "QUUX-V01-CS02-with-secp256k1_XMD:SHA-256_SSWU_RO_";
+    check_hash_to_curve<secp256k1_type>(
+        hash_to_curve<secp256k1_type>(std::string(""), secp256k1_ro_dst),
+        secp256k1_field_value_type(0xC1CAE290E291AEE617EBAEF1BE6D73861479C48B841EABA9B7B5852DDFEB1346_cppui_modular256),
+        secp256k1_field_value_type(0x64FA678E07AE116126F08B022A94AF6DE15985C996C3A91B64C406A960E51067_cppui_modular255));
+    check_hash_to_curve<secp256k1_type>(
+        hash_to_curve<secp256k1_type>(std::string("abc"), secp256k1_ro_dst),
+        secp256k1_field_value_type(0x3377E01EAB42DB296B512293120C6CEE72B6ECF9F9205760BD9FF11FB3CB2C4B_cppui_modular254),
+        secp256k1_field_value_type(0x7F95890F33EFEBD1044D382A01B1BEE0900FB6116F94688D487C6C7B9C8371F6_cppui_modular255));
+
+    // RFC 9380 J.8.2
+    check_hash_to_curve<secp256k1_type>(
+        encode_to_curve<secp256k1_type>(std::string("abc"),
+                                        std::string("QUUX-V01-CS02-with-secp256k1_XMD:SHA-256_SSWU_NU_")),
+        secp256k1_field_value_type(0x3F3B5842033FFF837D504BB4CE2A372BFEADBDBD84A1D2B678B6E1D7EE426B9D_cppui_modular254),
+        secp256k1_field_value_type(0x902910D1FEF15D8AE2006FC84F2A5A7BDA0E0407DC913062C3A493C4F5D876A5_cppui_modular256));
+
+    // BN254 G1 with the SVDW map, the suite of gnark-crypto
+    const std::string bn254_ro_dst = "QUUX-V01-CS02-with-BN254G1_XMD:SHA-256_SVDW_RO_";
+    check_hash_to_curve<bn254_type>(
+        hash_to_curve<bn254_type>(std::string(""), bn254_ro_dst),
+        bn254_field_value_type(0xA976AB906170DB1F9638D376514DBF8C42AEF256A54BBD48521F20749E59E86_cppui_modular252),
+        bn254_field_value_type(0x2925EAD66B9E68BFC309B014398640AB55F6619AB59BC1FAB2210AD4C4D53D5_cppui_modular250));
+    check_hash_to_curve<bn254_type>(
+        hash_to_curve<bn254_type>(std::string("abc"), bn254_ro_dst),
+        bn254_field_value_type(0x23F717BEE89B1003957139F193E6BE7DA1DF5F1374B26A4643B0378B5BAF53D1_cppui_modular254),
+        bn254_field_value_type(0x4142F826B71EE574452DBC47E05BC3E1A647478403A7BA38B7B93948F4E151D_cppui_modular251));
+    check_hash_to_curve<bn254_type>(
+        encode_to_curve<bn254_type>(std::string("abc"), std::string("QUUX-V01-CS02-with-BN254G1_XMD:SHA-256_SVDW_NU_")),
+        bn254_field_value_type(0xDA4A96147DF1F35B0F820BD35C6FAC3B80E8E320DE7C536B1E054667B22C332_cppui_modular252),
+        bn254_field_value_type(0x189BD3FBFFE4C8740D6543754D95C790E44CD2D162858E3B733D2B8387983BB7_cppui_modular253));
+
+    // Pallas and Vesta map_to_curve of fixed u, against map_to_curve_simple_swu followed by iso_map of the
+    // pasta_curves crate; u = 0 takes the exceptional case
+    using pallas_map_type = curves::detail::map_to_curve<pallas_type>;
+    using vesta_map_type = curves::detail::map_to_curve<vesta_type>;
+    check_hash_to_curve<pallas_type>(
+        pallas_map_type::process(pallas_field_value_type::zero()),
+        pallas_field_value_type(0x1F336F4CCD9C17A9C359E750686572F2BB5FEFEAC497947E1E2EC36F15879E3D_cppui_modular253),
+        pallas_field_value_type(0x2C8FF7B373A6DDF8AB299924BD74BA628DF067E44CFE9FE7525DBAC9B7F8F87F_cppui_modular254));
+    check_hash_to_curve<pallas_type>(
+        pallas_map_type::process(pallas_field_value_type::one()),
+        pallas_field_value_type(0x3CBB71EC72DB1A30F5E4BE9A926320F4108CFF65B5981332904B365C6823FDD6_cppui_modular254),
+        pallas_field_value_type(0x39F57ACBE6271F788D86C19556F067E10F7E70232531CCB3E1E067B8B0515773_cppui_modular254));
+    check_hash_to_curve<pallas_type>(
+        pallas_map_type::process(-pallas_field_value_type::one()),
+        pallas_field_value_type(0x3CBB71EC72DB1A30F5E4BE9A926320F4108CFF65B5981332904B365C6823FDD6_cppui_modular254),
+        pallas_field_value_type(0x60A853419D8E08772793E6AA90F981F12C828D8E41B2C67B74CC9344FAEA88E_cppui_modular251));
+    check_hash_to_curve<pallas_type>(
+        pallas_map_type::process(pallas_field_value_type(0x1234567890ABCDEFu)),
+        pallas_field_value_type(0x1CB201246FADDA77E2D773A0B12F2D30D42A25F68A48F5B346736E16FE3274D3_cppui_modular253),
+        pallas_field_value_type(0xBAEA7952D2F9E75221F87985DBE04915B4DC90083CC29AB44AAED08BDEF2A9F_cppui_modular252));
+
+    check_hash_to_curve<vesta_type>(
+        vesta_map_type::process(vesta_field_value_type::zero()),
+        vesta_field_value_type(0x2F7C89526BA435158F088721D715414A001D43B13BB98E8E3B9306C9BADD136_cppui_modular250),
+        vesta_field_value_type(0x2E1FA9840DEE9EC4865AF13923A262DF4B37FFD0D77AC1996021C6E86BBF2337_cppui_modular254));
+    check_hash_to_curve<vesta_type>(
+        vesta_map_type::process(vesta_field_value_type::one()),
+        vesta_field_value_type(0x36E4ABEB827850017AF478E21D32E794A35C57E9DFF0BF4FCFBD410CB5CC7A29_cppui_modular254),
+        vesta_field_value_type(0x12F3BE0F95977ED48CCBB6F08A1ED9EA83A31AA2287CB3E38746C80BD78A146B_cppui_modular253));
+    check_hash_to_curve<vesta_type>(
+        vesta_map_type::process(-vesta_field_value_type::one()),
+        vesta_field_value_type(0x36E4ABEB827850017AF478E21D32E794A35C57E9DFF0BF4FCFBD410CB5CC7A29_cppui_modular254),
+        vesta_field_value_type(0x2D0C41F06A68812B7334490F75E126159EA37E59E117F4FA050023152875EB96_cppui_modular254));
+    check_hash_to_curve<vesta_type>(
+        vesta_map_type::process(vesta_field_value_type(0x1234567890ABCDEFu)),
+        vesta_field_value_type(0x39BE4D279E460AECCAB26F32428F63F0DB8A2A489ECCBB2DD620D7A660902506_cppui_modular254),
+        vesta_field_value_type(0xA07C7D1328746EF858D891F1655F250FCAFC80A50C8AC5B3E4DB5E3173BC0E7_cppui_modular252));
+
+    // Pallas and Vesta with the isogenies of the Zcash pasta curves and expand_message_xmd over SHA-256. No
+    // published vectors use this suite, these are regression vectors of this implementation
+    const std::string pallas_ro_dst = "QUUX-V01-CS02-with-pallas_XMD:SHA-256_SSWU_RO_";
+    check_hash_to_curve<pallas_type>(
+        hash_to_curve<pallas_type>(std::string(""), pallas_ro_dst),
+        pallas_field_value_type(0x8D9956F24425586FA155C4AABDFDD6627E5078C4F9D40B12A735A1F47521A8B_cppui_modular252),
+        pallas_field_value_type(0x328EFEAB447F35CAAB39209B4D8E17B31443CE0C24F3A1EC6B8DB51399E7F146_cppui_modular254));
+    check_hash_to_curve<pallas_type>(
+        hash_to_curve<pallas_type>(std::string("abc"), pallas_ro_dst),
+        pallas_field_value_type(0x354714330E244E1BA390E700F62F122EA90C7B10EFED2E2C960501F3939C2A71_cppui_modular254),
+        pallas_field_value_type(0x10908F7CFC94E040BF741E4759D71CF598D3298CB51173CE77EE363D6109417_cppui_modular249));
+
+    const std::string vesta_ro_dst = "QUUX-V01-CS02-with-vesta_XMD:SHA-256_SSWU_RO_";
+    check_hash_to_curve<vesta_type>(
+        hash_to_curve<vesta_type>(std::string(""), vesta_ro_dst),
+        vesta_field_value_type(0x3DD8EE421E44E89C2C088CB46505002E32F8C6566F1D2583A7973D6D69D418D_cppui_modular250),
+        vesta_field_value_type(0x182EC24DB0070DE1291B930F0E46AA847A0B7E4A006BEFBA43CAFE1A700D0A26_cppui_modular253));
+    check_hash_to_curve<vesta_type>(
+        hash_to_curve<vesta_type>(std::string("abc"), vesta_ro_dst),
+        vesta_field_value_type(0x39D1EC3185CD0D9923C8C8F510BE92501C2209872E88FFCBB61A13EA5EF6A26B_cppui_modular254),
+        vesta_field_value_type(0x115E8945AA1A8C7D829773B34E559915980533DC3F7E70711465F6776ED4E8BF_cppui_modular253));
+
+    check_batch_hash_to_curve<secp256k1_type>(secp256k1_ro_dst);
+    check_batch_hash_to_curve<bn254_type>(bn254_ro_dst);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
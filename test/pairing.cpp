@@ -36,18 +36,23 @@
 
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
+#include <boost/random/mersenne_twister.hpp>
 
 #include <nil/crypto3/multiprecision/cpp_int_modular.hpp>
 
+#include <nil/crypto3/algebra/curves/alt_bn128.hpp>
 #include <nil/crypto3/algebra/curves/bls12.hpp>
 #include <nil/crypto3/algebra/curves/mnt4.hpp>
 #include <nil/crypto3/algebra/curves/mnt6.hpp>
 
+#include <nil/crypto3/algebra/pairing/alt_bn128.hpp>
 #include <nil/crypto3/algebra/pairing/bls12.hpp>
 #include <nil/crypto3/algebra/pairing/mnt4.hpp>
 #include <nil/crypto3/algebra/pairing/mnt6.hpp>
 
+#include <nil/crypto3/algebra/algorithms/batch_pair.hpp>
 #include <nil/crypto3/algebra/algorithms/pair.hpp>
+#include <nil/crypto3/algebra/algorithms/parallel_pair.hpp>
 
 #include <nil/crypto3/algebra/fields/detail/element/fp.hpp>
 #include <nil/crypto3/algebra/fields/detail/element/fp4.hpp>
@@ -192,6 +197,43 @@ void check_pairing_operations(std::vector<Fr_value_type> &Fr_elements,
                       double_miller_loop<CurveType>(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1],
                                                    G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]));
     std::cout << " * Miller loop tests finished." << std::endl << std::endl;
+
+    std::cout << " * Multi Miller loop tests started..." << std::endl;
+    using precomputed_pair_type = std::pair<g1_precomp_value_type, g2_precomp_value_type>;
+    std::vector<precomputed_pair_type> precomputed_pairs = {
+        {G1_prec_elements[prec_A1], G2_prec_elements[prec_B1]},
+        {G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]}};
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(precomputed_pairs),
+                      double_miller_loop<CurveType>(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1],
+                                                   G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]));
+    precomputed_pairs.emplace_back(precompute_g1<CurveType>(G1_elements[C1]), precompute_g2<CurveType>(G2_elements[VKz]));
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(precomputed_pairs.begin(), precomputed_pairs.end()),
+                      miller_loop<CurveType>(G1_prec_elements[prec_A1], G2_prec_elements[prec_B1]) *
+                          miller_loop<CurveType>(G1_prec_elements[prec_A2], G2_prec_elements[prec_B2]) *
+                          miller_loop<CurveType>(precomputed_pairs[2].first, precomputed_pairs[2].second));
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(std::vector<precomputed_pair_type>()), GT_value_type::one());
+    std::cout << " * Multi Miller loop tests finished." << std::endl << std::endl;
+
+    std::cout << " * Pairing product check tests started..." << std::endl;
+    // e(A1, B1) = e(VKx, VKy) * e(C1, VKz)
+    std::vector<G1_value_type> check_g1 = {G1_elements[A1], -G1_elements[VKx], -G1_elements[C1], G1_value_type::zero()};
+    std::vector<G2_value_type> check_g2 = {G2_elements[B1], G2_elements[VKy], G2_elements[VKz], G2_elements[B2]};
+    BOOST_CHECK(pairing_product_check<CurveType>(check_g1.begin(), check_g1.end(), check_g2.begin()));
+    check_g1[1] = G1_elements[VKx];
+    BOOST_CHECK(!pairing_product_check<CurveType>(check_g1.begin(), check_g1.end(), check_g2.begin()));
+    std::cout << " * Pairing product check tests finished." << std::endl << std::endl;
+
+    std::cout << " * Parallel multi-pairing tests started..." << std::endl;
+    for (std::size_t threads_count : {1, 2, 3, 8}) {
+        BOOST_CHECK_EQUAL(
+            parallel_multi_miller_loop<CurveType>(precomputed_pairs.begin(), precomputed_pairs.end(), threads_count),
+            multi_miller_loop<CurveType>(precomputed_pairs));
+        BOOST_CHECK(
+            !parallel_pairing_product_check<CurveType>(check_g1.begin(), check_g1.end(), check_g2.begin(), threads_count));
+    }
+    check_g1[1] = -G1_elements[VKx];
+    BOOST_CHECK(parallel_pairing_product_check<CurveType>(check_g1.begin(), check_g1.end(), check_g2.begin(), 2));
+    std::cout << " * Parallel multi-pairing tests finished." << std::endl << std::endl;
 }
 
 template<typename ElementType>
@@ -430,16 +472,18 @@ void pairing_test_g2_precomp_init(std::vector<typename pairing::pairing_policy<c
         elements.back().QX = field_element_init<g2_field_value_type>::process(elem.second.get_child("QX").front());
         elements.back().QY = field_element_init<g2_field_value_type>::process(elem.second.get_child("QY").front());
 
+        std::size_t idx = 0;
         for (auto &elem_coeffs : elem.second.get_child("coeffs")) {
-            elements.back().coeffs.emplace_back(coeffs_type());
+            BOOST_REQUIRE_LT(idx, elements.back().coeffs.size());
+            coeffs_type &coeffs = elements.back().coeffs[idx++];
 
-            elements.back().coeffs.back().ell_0 =
-                field_element_init<coeffs_value_type>::process(elem_coeffs.second.get_child("ell_0").front());
-            elements.back().coeffs.back().ell_VW =
+            coeffs.ell_0 = field_element_init<coeffs_value_type>::process(elem_coeffs.second.get_child("ell_0").front());
+            coeffs.ell_VW =
                 field_element_init<coeffs_value_type>::process(elem_coeffs.second.get_child("ell_VW").front());
-            elements.back().coeffs.back().ell_VV =
+            coeffs.ell_VV =
                 field_element_init<coeffs_value_type>::process(elem_coeffs.second.get_child("ell_VV").front());
         }
+        BOOST_REQUIRE_EQUAL(idx, elements.back().coeffs.size());
     }
 }
 
@@ -558,6 +602,86 @@ void pairing_test_init(std::vector<Fr_value_type> &Fr_elements,
     pairing_test_g2_precomp_init(G2_prec_elements, test_set);
 }
 
+template<typename CurveType, typename ReduceFunction>
+void check_affine_miller_loop(ReduceFunction reduce) {
+    using g1_value_type = typename CurveType::template g1_type<>::value_type;
+    using g2_value_type = typename CurveType::template g2_type<>::value_type;
+    using gt_value_type = typename CurveType::gt_type::value_type;
+    using scalar_field_type = typename CurveType::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+
+    auto affine_pair = [&](const g1_value_type &P, const g2_value_type &Q) {
+        return reduce(affine_miller_loop<CurveType>(precompute_g1<CurveType>(P), affine_precompute_g2<CurveType>(Q)));
+    };
+
+    const scalar_value_type a(0x1234567u), b(0x89ABCDEFu);
+    const g1_value_type P = g1_value_type::one();
+    const g2_value_type Q = g2_value_type::one();
+
+    const gt_value_type e = affine_pair(P, Q);
+    BOOST_CHECK(e != gt_value_type::one());
+    BOOST_CHECK_EQUAL(e.pow(scalar_field_type::modulus), gt_value_type::one());
+    BOOST_CHECK_EQUAL(affine_pair(a * P, Q), e.pow(a.data));
+    BOOST_CHECK_EQUAL(affine_pair(P, b * Q), e.pow(b.data));
+    BOOST_CHECK_EQUAL(affine_pair(a * P, b * Q), affine_pair(b * P, a * Q));
+    BOOST_CHECK_EQUAL(affine_pair(g1_value_type::zero(), Q), gt_value_type::one());
+    BOOST_CHECK_EQUAL(affine_pair(P, g2_value_type::zero()), gt_value_type::one());
+}
+
+template<typename CurveType, typename ReduceFunction>
+void check_ate_miller_loops(std::size_t coeffs_count, ReduceFunction reduce) {
+    using g1_value_type = typename CurveType::template g1_type<>::value_type;
+    using g2_value_type = typename CurveType::template g2_type<>::value_type;
+    using scalar_value_type = typename CurveType::scalar_field_type::value_type;
+    using g1_precomp_value_type = typename pairing::pairing_policy<CurveType>::g1_precomputed_type;
+    using g2_precomp_value_type = typename pairing::pairing_policy<CurveType>::g2_precomputed_type;
+
+    BOOST_CHECK_EQUAL(std::tuple_size<typename g2_precomp_value_type::coeffs_container_type>::value, coeffs_count);
+
+    const g1_value_type P1 = scalar_value_type(0x2468ACEu) * g1_value_type::one();
+    const g2_value_type Q1 = scalar_value_type(0x13579BDu) * g2_value_type::one();
+    const g1_value_type P2 = scalar_value_type(0xFEDCBAu) * g1_value_type::one();
+    const g2_value_type Q2 = scalar_value_type(0x7654321u) * g2_value_type::one();
+
+    const g1_precomp_value_type prec_P1 = precompute_g1<CurveType>(P1), prec_P2 = precompute_g1<CurveType>(P2);
+    const g2_precomp_value_type prec_Q1 = precompute_g2<CurveType>(Q1), prec_Q2 = precompute_g2<CurveType>(Q2);
+
+    // lines of the projective and affine precomputations differ by factors killed by the final exponentiation
+    BOOST_CHECK_EQUAL(reduce(miller_loop<CurveType>(prec_P1, prec_Q1)),
+                      reduce(affine_miller_loop<CurveType>(prec_P1, affine_precompute_g2<CurveType>(Q1))));
+    BOOST_CHECK_EQUAL(reduce(miller_loop<CurveType>(prec_P1, prec_Q1)),
+                      reduce(miller_loop<CurveType>(precompute_g1<CurveType>(g1_value_type::one()),
+                                                    precompute_g2<CurveType>(g2_value_type::one())))
+                          .pow((scalar_value_type(0x2468ACEu) * scalar_value_type(0x13579BDu)).data));
+
+    // line pairing inside the double and multi loops must not change the unreduced value
+    BOOST_CHECK_EQUAL(double_miller_loop<CurveType>(prec_P1, prec_Q1, prec_P2, prec_Q2),
+                      miller_loop<CurveType>(prec_P1, prec_Q1) * miller_loop<CurveType>(prec_P2, prec_Q2));
+    std::vector<std::pair<g1_precomp_value_type, g2_precomp_value_type>> precomputed_pairs = {{prec_P1, prec_Q1},
+                                                                                             {prec_P2, prec_Q2}};
+    BOOST_CHECK_EQUAL(multi_miller_loop<CurveType>(precomputed_pairs),
+                      double_miller_loop<CurveType>(prec_P1, prec_Q1, prec_P2, prec_Q2));
+}
+
+template<typename CurveType>
+void check_pairing_params_constants() {
+    using params_type = pairing::detail::pairing_params<CurveType>;
+    using g1_field_value_type = typename CurveType::base_field_type::value_type;
+    using g2_field_value_type = typename CurveType::template g2_type<>::field_type::value_type;
+    using g2_affine_value_type = typename CurveType::template g2_type<curves::coordinates::affine>::value_type;
+
+    BOOST_CHECK_EQUAL(params_type::two_inv * g1_field_value_type(2u), g1_field_value_type::one());
+    BOOST_CHECK_EQUAL(params_type::three_twist_coeff_b, g2_field_value_type(3u) * params_type::twist_coeff_b);
+    BOOST_CHECK_EQUAL(params_type::twist_inv * params_type::twist, g2_field_value_type::one());
+
+    // psi maps the twist to itself
+    const g2_affine_value_type Q = CurveType::template g2_type<>::value_type::one().to_affine();
+    const g2_field_value_type psi_X = Q.X.Frobenius_map(1) * params_type::twist_mul_by_q_X;
+    const g2_field_value_type psi_Y = Q.Y.Frobenius_map(1) * params_type::twist_mul_by_q_Y;
+    BOOST_CHECK(psi_X != Q.X);
+    BOOST_CHECK_EQUAL(psi_Y.squared(), psi_X.squared() * psi_X + params_type::twist_coeff_b);
+}
+
 template<typename CurveType, typename TestSet>
 void pairing_operation_test(const TestSet &test_set) {
     std::vector<typename CurveType::scalar_field_type::value_type> Fr_elements;
@@ -582,6 +706,255 @@ BOOST_DATA_TEST_CASE(pairing_operation_test_bls12_381, string_data("pairing_oper
     pairing_operation_test<curve_type>(data_set);
 }
 
+BOOST_AUTO_TEST_CASE(g2_precomputed_serialization_test_bls12_381) {
+    using curve_type = curves::bls12<381>;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using g2_precomputed_type = typename pairing::pairing_policy<curve_type>::g2_precomputed_type;
+
+    const g2_precomputed_type prec_Q =
+        precompute_g2<curve_type>(typename curve_type::scalar_field_type::value_type(0x1234567u) * g2_value_type::one());
+
+    std::vector<std::uint8_t> bytes(g2_precomputed_type::serialized_size);
+    BOOST_CHECK(prec_Q.to_bytes(bytes.begin()) == bytes.end());
+
+    g2_precomputed_type restored;
+    BOOST_CHECK(restored.from_bytes(bytes.begin(), bytes.end()));
+    BOOST_CHECK_EQUAL(restored, prec_Q);
+
+    const typename curve_type::template g1_type<>::value_type P = curve_type::template g1_type<>::value_type::one();
+    BOOST_CHECK_EQUAL(miller_loop<curve_type>(precompute_g1<curve_type>(P), restored),
+                      miller_loop<curve_type>(precompute_g1<curve_type>(P), prec_Q));
+
+    // A coordinate that is not reduced modulo p must be rejected.
+    bytes[0] = 0xFF;
+    BOOST_CHECK(!restored.from_bytes(bytes.begin(), bytes.end()));
+    BOOST_CHECK(!restored.from_bytes(bytes.begin(), bytes.end() - 1));
+}
+
+BOOST_AUTO_TEST_CASE(affine_miller_loop_test_bls12_381) {
+    using curve_type = curves::bls12<381>;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+
+    check_affine_miller_loop<curve_type>(
+        [](const typename curve_type::gt_type::value_type &f) { return final_exponentiation<curve_type>(f); });
+
+    const g1_value_type P = typename curve_type::scalar_field_type::value_type(0x2468ACEu) * g1_value_type::one();
+    const g2_value_type Q = typename curve_type::scalar_field_type::value_type(0x13579BDu) * g2_value_type::one();
+    BOOST_CHECK_EQUAL(
+        final_exponentiation<curve_type>(
+            affine_miller_loop<curve_type>(precompute_g1<curve_type>(P), affine_precompute_g2<curve_type>(Q))),
+        pair_reduced<curve_type>(P, Q));
+}
+
+BOOST_AUTO_TEST_CASE(affine_miller_loop_test_bls12_377) {
+    using curve_type = curves::bls12<377>;
+
+    check_affine_miller_loop<curve_type>(
+        [](const typename curve_type::gt_type::value_type &f) { return final_exponentiation<curve_type>(f); });
+}
+
+BOOST_AUTO_TEST_CASE(affine_miller_loop_test_alt_bn128_254) {
+    using curve_type = curves::alt_bn128<254>;
+
+    check_affine_miller_loop<curve_type>(
+        [](const typename curve_type::gt_type::value_type &f) { return final_exponentiation<curve_type>(f); });
+}
+
+BOOST_AUTO_TEST_CASE(pairing_params_constants_test) {
+    check_pairing_params_constants<curves::bls12<381>>();
+    check_pairing_params_constants<curves::bls12<377>>();
+    check_pairing_params_constants<curves::alt_bn128<254>>();
+
+    using mnt4_params_type = pairing::detail::pairing_params<curves::mnt4<298>>;
+    using mnt6_params_type = pairing::detail::pairing_params<curves::mnt6<298>>;
+    BOOST_CHECK_EQUAL(mnt4_params_type::twist_inv * mnt4_params_type::twist,
+                      curves::mnt4<298>::g2_type<>::field_type::value_type::one());
+    BOOST_CHECK_EQUAL(mnt4_params_type::twist_squared, mnt4_params_type::twist.squared());
+    BOOST_CHECK_EQUAL(mnt6_params_type::twist_inv * mnt6_params_type::twist,
+                      curves::mnt6<298>::g2_type<>::field_type::value_type::one());
+    BOOST_CHECK_EQUAL(mnt6_params_type::twist_squared, mnt6_params_type::twist.squared());
+}
+
+BOOST_AUTO_TEST_CASE(ate_miller_loop_test_bls12_381) {
+    using curve_type = curves::bls12<381>;
+
+    // binary digits of |u|: 63 doublings and 5 additions
+    check_ate_miller_loops<curve_type>(
+        68, [](const typename curve_type::gt_type::value_type &f) { return final_exponentiation<curve_type>(f); });
+}
+
+BOOST_AUTO_TEST_CASE(ate_miller_loop_test_bls12_377) {
+    using curve_type = curves::bls12<377>;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+    using scalar_field_type = typename curve_type::scalar_field_type;
+    using scalar_value_type = typename scalar_field_type::value_type;
+
+    // binary digits of u: 63 doublings and 6 additions, with the D-type lines
+    check_ate_miller_loops<curve_type>(
+        69, [](const gt_value_type &f) { return final_exponentiation<curve_type>(f); });
+
+    const scalar_value_type a(0x1234567u), b(0x89ABCDEFu);
+    const g1_value_type P = g1_value_type::one();
+    const g2_value_type Q = g2_value_type::one();
+
+    const gt_value_type e = pair_reduced<curve_type>(P, Q);
+    BOOST_CHECK(e != gt_value_type::one());
+    BOOST_CHECK_EQUAL(e.pow(scalar_field_type::modulus), gt_value_type::one());
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(a * P, Q), e.pow(a.data));
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(P, b * Q), e.pow(b.data));
+    BOOST_CHECK_EQUAL(pair_reduced<curve_type>(a * P, b * Q), pair_reduced<curve_type>(b * P, a * Q));
+    BOOST_CHECK_EQUAL(
+        e, final_exponentiation<curve_type>(
+               affine_miller_loop<curve_type>(precompute_g1<curve_type>(P), affine_precompute_g2<curve_type>(Q))));
+}
+
+BOOST_AUTO_TEST_CASE(parallel_pairing_product_check_test_bls12_377) {
+    using curve_type = curves::bls12<377>;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+    using g1_precomp_value_type = typename pairing::pairing_policy<curve_type>::g1_precomputed_type;
+    using g2_precomp_value_type = typename pairing::pairing_policy<curve_type>::g2_precomputed_type;
+
+    const scalar_value_type a(0x1234567u), b(0x89ABCDEFu);
+    const g1_value_type P = g1_value_type::one();
+    const g2_value_type Q = g2_value_type::one();
+
+    // e(a*P, b*Q) * e(-P, a*b*Q) * e(b*P, -a*Q) * e(a*b*P, Q) = 1
+    std::vector<g1_value_type> check_g1 = {a * P, -P, b * P, (a * b) * P, g1_value_type::zero()};
+    std::vector<g2_value_type> check_g2 = {b * Q, (a * b) * Q, -(a * Q), Q, Q};
+
+    std::vector<std::pair<g1_precomp_value_type, g2_precomp_value_type>> precomputed_pairs;
+    for (std::size_t i = 0; i < 4; ++i) {
+        precomputed_pairs.emplace_back(precompute_g1<curve_type>(check_g1[i]), precompute_g2<curve_type>(check_g2[i]));
+    }
+
+    for (std::size_t threads_count : {1, 2, 3}) {
+        BOOST_CHECK_EQUAL(
+            parallel_multi_miller_loop<curve_type>(precomputed_pairs.begin(), precomputed_pairs.end(), threads_count),
+            multi_miller_loop<curve_type>(precomputed_pairs));
+        BOOST_CHECK(parallel_pairing_product_check<curve_type>(check_g1.begin(), check_g1.end(), check_g2.begin(),
+                                                               threads_count));
+    }
+    BOOST_CHECK(pairing_product_check<curve_type>(check_g1.begin(), check_g1.end(), check_g2.begin()));
+
+    check_g1[1] = P;
+    for (std::size_t threads_count : {1, 2, 3}) {
+        BOOST_CHECK(!parallel_pairing_product_check<curve_type>(check_g1.begin(), check_g1.end(), check_g2.begin(),
+                                                                threads_count));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ate_miller_loop_test_alt_bn128_254) {
+    using curve_type = curves::alt_bn128<254>;
+
+    // NAF of 6u+2: 65 doublings, 21 additions, then the two Frobenius lines
+    check_ate_miller_loops<curve_type>(
+        88, [](const typename curve_type::gt_type::value_type &f) { return final_exponentiation<curve_type>(f); });
+}
+
+BOOST_AUTO_TEST_CASE(final_exponentiation_test_alt_bn128_254) {
+    using curve_type = curves::alt_bn128<254>;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using gt_value_type = typename curve_type::gt_type::value_type;
+
+    const gt_value_type f = miller_loop<curve_type>(precompute_g1<curve_type>(g1_value_type::one()),
+                                                    precompute_g2<curve_type>(g2_value_type::one()));
+
+    // the hard part is exact, not a multiple of (p^4-p^2+1)/r
+    BOOST_CHECK_EQUAL(final_exponentiation<curve_type>(f),
+                      f.pow(pairing::detail::pairing_params<curve_type>::final_exponent));
+    BOOST_CHECK_EQUAL(final_exponentiation<curve_type>(f * f), final_exponentiation<curve_type>(f).squared());
+    BOOST_CHECK_EQUAL(final_exponentiation<curve_type>(gt_value_type::one()), gt_value_type::one());
+}
+
+BOOST_AUTO_TEST_CASE(batch_pairing_verifier_test_bls12_381) {
+    using curve_type = curves::bls12<381>;
+    using g1_value_type = typename curve_type::template g1_type<>::value_type;
+    using g2_value_type = typename curve_type::template g2_type<>::value_type;
+    using scalar_value_type = typename curve_type::scalar_field_type::value_type;
+    using equation_type = std::vector<std::pair<g1_value_type, g2_value_type>>;
+
+    // Groth16-like equations e(a*P, b*Q) * e(-(a*b + c)*P, Q) * e(c*P, Q) = 1 sharing the G2 argument Q
+    const g1_value_type P = g1_value_type::one();
+    const g2_value_type Q = g2_value_type::one();
+    std::vector<equation_type> equations;
+    for (unsigned i = 1; i <= 4; ++i) {
+        const scalar_value_type a(0x1234567u * i), b(0x89ABCDEu + i), c(0x2468u * i);
+        equations.push_back({{a * P, b * Q}, {-(a * b + c) * P, Q}, {c * P, Q}, {g1_value_type::zero(), Q}});
+    }
+
+    batch_pairing_verifier<curve_type> verifier;
+    for (const equation_type &equation : equations) {
+        verifier.add_equation(equation);
+    }
+    BOOST_CHECK_EQUAL(verifier.equations_size(), 4);
+    // Q plus the four b*Q
+    BOOST_CHECK_EQUAL(verifier.distinct_g2_size(), 5);
+    BOOST_CHECK(verifier.verify());
+    BOOST_CHECK(batch_pairing_product_check<curve_type>(equations.begin(), equations.end()));
+
+    // the random scalars may come from the caller's generator, a deterministic one for a reproducible test
+    boost::random::mt19937 rng(0x5EED);
+    batch_pairing_verifier<curve_type> seeded_verifier;
+    for (const equation_type &equation : equations) {
+        seeded_verifier.add_equation(equation, rng);
+    }
+    BOOST_CHECK(seeded_verifier.verify());
+
+    equations[2][2].first = equations[2][2].first + P;
+    BOOST_CHECK(!batch_pairing_product_check<curve_type>(equations.begin(), equations.end()));
+
+    BOOST_CHECK(batch_pairing_verifier<curve_type>().verify());
+}
+
+template<typename CurveType>
+void check_gt_exponentiation() {
+    using params_type = pairing::detail::pairing_params<CurveType>;
+    using g1_value_type = typename CurveType::template g1_type<>::value_type;
+    using g2_value_type = typename CurveType::template g2_type<>::value_type;
+    using gt_value_type = typename CurveType::gt_type::value_type;
+    using scalar_value_type = typename CurveType::scalar_field_type::value_type;
+
+    const gt_value_type g = pair_reduced<CurveType>(g1_value_type::one(), g2_value_type::one());
+
+    // the Frobenius eigenvalue the exponent digits rely on
+    const gt_value_type g_lambda = g.cyclotomic_exp(params_type::gt_frobenius_eigenvalue);
+    BOOST_CHECK_EQUAL(g.Frobenius_map(1),
+                      params_type::gt_is_frobenius_eigenvalue_neg ? g_lambda.unitary_inversed() : g_lambda);
+
+    const scalar_value_type a(0x123456789ABCDEFu);
+    const scalar_value_type exponents[] = {scalar_value_type::zero(), scalar_value_type::one(), a,
+                                           a * a * a * a + a, -scalar_value_type::one()};
+    for (const scalar_value_type &e : exponents) {
+        BOOST_CHECK_EQUAL(gt_exponentiation<CurveType>(g, e), g.pow(e.data));
+    }
+    BOOST_CHECK_EQUAL(gt_exponentiation<CurveType>(g, -scalar_value_type::one()), g.unitary_inversed());
+
+    typename gt_value_type::underlying_type c;
+    BOOST_CHECK(!gt_value_type::one().torus_compress(c));
+    BOOST_CHECK(gt_value_type(-gt_value_type::one()).torus_compress(c));
+    BOOST_CHECK_EQUAL(gt_value_type::torus_decompress(c), -gt_value_type::one());
+    for (const scalar_value_type &e : exponents) {
+        const gt_value_type h = gt_exponentiation<CurveType>(g, e);
+        if (h.is_one()) {
+            continue;
+        }
+        BOOST_CHECK(h.torus_compress(c));
+        BOOST_CHECK_EQUAL(gt_value_type::torus_decompress(c), h);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(gt_exponentiation_test) {
+    check_gt_exponentiation<curves::bls12<381>>();
+    check_gt_exponentiation<curves::bls12<377>>();
+    check_gt_exponentiation<curves::alt_bn128<254>>();
+}
+
 BOOST_DATA_TEST_CASE(pairing_operation_test_mnt4_298, string_data("pairing_operation_test_mnt4_298"), data_set) {
     using curve_type = typename curves::mnt4<298>;
 